@@ -55,6 +55,10 @@ typedef struct {
     // Editor options
     int soundSlotActive;
     int prevSoundSlotActive;
+    int soundSlotCount;
+    bool soundSlotEditMode;
+    bool btnAddSoundPressed;
+    bool btnSoundListPressed;
 
     // Tool options
     //...
@@ -140,6 +144,10 @@ GuiMainToolbarState InitGuiMainToolbar(void)
     // Edit options
     state.soundSlotActive = 0;
     state.prevSoundSlotActive = 0;
+    state.soundSlotCount = 1;
+    state.soundSlotEditMode = false;
+    state.btnAddSoundPressed = false;
+    state.btnSoundListPressed = false;
 
     // Tool options
     //...
@@ -191,11 +199,17 @@ void GuiMainToolbar(GuiMainToolbarState *state)
     // Edit options
     GuiLabel((Rectangle){ state->anchorEdit.x + 12, state->anchorEdit.y + 8, 80, 24 }, "Slot:");
 
-    int tooglePadding = GuiGetStyle(TOGGLE, GROUP_PADDING);
-    GuiSetStyle(TOGGLE, GROUP_PADDING, 2);
-    GuiSetTooltip("Select current sound slot");
-    GuiToggleGroup((Rectangle){ state->anchorEdit.x + 12 + 36, state->anchorEdit.y + 8, 16, 24 }, "1;2;3;4;5;6;7;8;9;10", &state->soundSlotActive);
-    GuiSetStyle(TOGGLE, GROUP_PADDING, tooglePadding);
+    // NOTE: Spinner shows sound number (1-based), any number of sounds available
+    int soundSlotValue = state->soundSlotActive + 1;
+    GuiSetTooltip("Select current sound");
+    if (GuiSpinner((Rectangle){ state->anchorEdit.x + 12 + 36, state->anchorEdit.y + 8, 80, 24 }, NULL, &soundSlotValue, 1, state->soundSlotCount, state->soundSlotEditMode)) state->soundSlotEditMode = !state->soundSlotEditMode;
+    state->soundSlotActive = soundSlotValue - 1;
+    GuiLabel((Rectangle){ state->anchorEdit.x + 12 + 36 + 80 + 4, state->anchorEdit.y + 8, 40, 24 }, TextFormat("/ %i", state->soundSlotCount));
+
+    GuiSetTooltip("Add new sound");
+    state->btnAddSoundPressed = GuiButton((Rectangle){ state->anchorVisuals.x - 12 - 48 - 4, state->anchorEdit.y + 8, 24, 24 }, "#234#");
+    GuiSetTooltip("Show sounds list (TAB)");
+    state->btnSoundListPressed = GuiButton((Rectangle){ state->anchorVisuals.x - 12 - 24, state->anchorEdit.y + 8, 24, 24 }, "#197#");
 
     // Tool options
     //...
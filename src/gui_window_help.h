@@ -114,14 +114,19 @@ static const char *helpLines[] = {
     "F3 - Show Issue Report window",
     //"F4 - Show User window",
     "-File Controls",
-    "LCTRL + N - Reset sound slot",
+    "LCTRL + N - Reset current sound",
     "LCTRL + O - Open sound file (.rfx)",
     "LCTRL + S - Save sound file (.rfx)",
     "LCTRL + E - Export wave file",
+    "LCTRL + C - Copy sound as share text",
+    "LCTRL + V - Paste sound from share text",
     "-Tool Controls",
-    "1..0 - Select current sound slot",
-    "SPACE - Play current sound slot",
+    "1..0 - Select current sound (first 10)",
+    "SPACE - Play current sound",
     "P - Toggle autoplay on params change",
+    "L - Toggle live preview on sliders drag",
+    "E - Explore sounds (candidates grid)",
+    "TAB - Show sounds list",
     "-Tool Visuals",
     //"LEFT | RIGHT - Select visual style",
     "LCTRL + F - Toggle double screen size",
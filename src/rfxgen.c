@@ -5,9 +5,21 @@
 *   FEATURES:
 *       - Predefined sound presets (Coin, Shoot, Explosion, PowerUp...)
 *       - Multiple wave types supported (Square, Sawtooth, Sine, Noise)
-*       - Up to 5 sound slots to store generated sound (temporary save)
+*       - Sounds list with any number of sounds, rendered on demand, least recently used waves evicted
 *       - Load/Save .rfx files with sound generation parameters (104 bytes only)
 *       - Export wave data as .wav, .qoa, .raw or .h code file (byte array)
+*       - Export wave data as IMA-ADPCM .wav (4 bit), decoder available in rfxgen.h
+*       - Export wave data as .bin data file and .h header to embed it (#embed/.incbin)
+*       - Export wave parameters as .h code file with a minimal generator (synthesized at runtime)
+*       - Waves generated on a background thread, UI never blocks on long sounds
+*       - Progressive playback, sounds start playing while still being generated
+*       - Wave drawing from min/max/rms peaks (no aliasing), only redrawn on wave changes
+*       - Live preview while dragging sliders, sound generated in real time (looping)
+*       - Draft waves while interacting (lower quality, truncated), full quality once idle
+*       - Spectrogram view next to wave view, computed on a background thread (real FFT)
+*       - Sound slots allocated on first generation, sound audio buffers reused when new wave fits
+*       - Explore window, grid of 16-64 candidate sounds rendered in parallel, played on hover
+*       - Generator buttons next results rendered while idle (seeded), swapped in with no generation wait
 *       - Configurable sample-rate, bits-per-sample and channels on export
 *       - Multiple UI styles with support for custom ones (.rgs)
 *       - Sound generator as OSS single-file header-only lib: rfxgen.h
@@ -153,6 +165,7 @@
 
 #define RFXGEN_IMPLEMENTATION
 #define RFXGEN_CALLOC           RL_CALLOC
+#define RFXGEN_REALLOC          RL_REALLOC
 #define RFXGEN_FREE             RL_FREE
 #define RFXGEN_RAND             GetRandomValue      // Using raylib provided generator: rprand
 #define RFXGEN_SRAND            SetRandomSeed       // Using raylib provided generator: rprand
@@ -176,6 +189,12 @@
 #define GUI_FILE_DIALOGS_IMPLEMENTATION
 #include "gui_file_dialogs.h"               // GUI: File Dialogs
 
+#if defined(PLATFORM_DESKTOP)
+    #define RFXGEN_CLI_IMPLEMENTATION
+    #define RFXGEN_CLI_USE_RAYLIB               // Use raylib for audio loading and CLI player
+    #include "rfxgen_cli.h"                 // Command-line interface: ProcessCommandLine()
+#endif
+
 // raygui embedded styles
 // NOTE: Included in the same order as selector
 #define MAX_GUI_STYLES_AVAILABLE   5        // NOTE: Included light style
@@ -186,20 +205,12 @@
 #include "styles/style_amber.h"             // raygui style: amber
 
 // C standard library
-#include <math.h>                   // Required for: sinf(), powf()
+#include <math.h>                   // Required for: sinf(), cosf(), powf(), log10f()
 #include <time.h>                   // Required for: clock()
 #include <stdlib.h>                 // Required for: calloc(), free()
 #include <string.h>                 // Required for: strcmp()
 #include <stdio.h>                  // Required for: FILE, fopen(), fread(), fwrite(), ftell(), fseek() fclose()
                                     // NOTE: Used on functions: LoadSound(), SaveSound(), WriteWAV()
-#if defined(_WIN32)
-    #include <conio.h>              // Required for: kbhit() [Windows only, no stardard library]
-#else
-    // Provide kbhit() function in non-Windows platforms
-    #include <termios.h>
-    #include <unistd.h>
-    #include <fcntl.h>
-#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -214,10 +225,211 @@ bool __stdcall FreeConsole(void);           // Close console from code (kernel32
 #if defined(SUPPORT_LOG_INFO) && defined(_DEBUG)
     #define LOG(...) printf(__VA_ARGS__)
 #else
-    #define LOG(...)
+    #define LOG(...) do { } while (0)
+#endif
+
+// Generate waves on a background worker thread, UI is not blocked by long sounds
+// NOTE: Requires threads and semaphores (rfxgen.h), not available on web
+#if !defined(RFXGEN_NO_THREADS)
+    #define SUPPORT_WAVE_WORKER
+#endif
+#define WAVE_WORKER_BLOCK_FRAMES   4096     // Frames generated between worker cancellation checks
+#define WAVE_WORKER_MAX_FRAMES     (RFXGEN_MAX_GEN_BUFFER_LENGTH*RFXGEN_GEN_SAMPLE_RATE)    // Max frames generated (10 seconds)
+#define WAVE_STREAM_BUFFER_FRAMES  2048     // Progressive playback audio stream sub-buffer size
+#define SOUND_UPDATE_MAX_SILENCE   0.05     // Sound buffer reused if wave is shorter by this time at most (seconds), otherwise reloaded
+
+#define WAVE_DRAFT_SUPERSAMPLING      2     // Draft wave generation supersampling (full quality: RFXGEN_GEN_SUPERSAMPLING)
+#define WAVE_DRAFT_MAX_FRAMES      (2*RFXGEN_GEN_SAMPLE_RATE)   // Draft wave max frames generated (2 seconds)
+#define WAVE_DRAFT_IDLE_TIME        0.5     // Time without requests to consider interaction stopped (seconds)
+
+#define WAVE_PEAKS_BLOCK_FRAMES      64     // Wave peaks first level block size (frames)
+#define WAVE_PEAKS_MAX_LEVELS        16     // Wave peaks max levels, every level merges two blocks of previous one
+
+#define SPECTROGRAM_FFT_SIZE        512     // Spectrogram FFT window size (frames), power of two
+#define SPECTROGRAM_MIN_DB       -90.0f     // Spectrogram min level shown (dB), full scale sine is 0 dB
+
+#define EXPLORE_MAX_CANDIDATES       64     // Explore grid max candidates (8x8)
+#define EXPLORE_MAX_FRAMES         (2*RFXGEN_GEN_SAMPLE_RATE)   // Explore candidates max frames rendered (2 seconds preview)
+
+#define WAVE_PREFETCH_SOURCES         9     // Generator buttons prefetched: presets (0-6), Randomize (7), Mutate (8)
+#define WAVE_PREFETCH_QUEUE_SIZE      2     // Results rendered ahead per generator button (Mutate: 1, depends on current sound)
+#define WAVE_PREFETCH_SLOT           -1     // Wave worker slot used by prefetch requests
+
+#define SOUND_LIST_MEMORY_BUDGET   (32*1024*1024)   // Sound list rendered waves max memory (bytes), least recently used evicted
+#define SOUND_LIST_ROW_HEIGHT        32     // Sound list window row height
+
+#define LIVE_VOICE_QUEUE_SIZE        16     // Live voice parameters queue size (power of two)
+#define LIVE_VOICE_BUFFER_FRAMES    512     // Live voice audio stream sub-buffer size (low latency)
+#define LIVE_VOICE_STOP_FRAMES       30     // Live voice max frames waiting for audio thread to stop
+
+// Atomic load/store, used by lock-free queue between main and audio threads
+#if defined(_MSC_VER)
+    #include <intrin.h>                     // Required for: _InterlockedOr(), _InterlockedExchange()
+    #define ATOMIC_LOAD(ptr)            (unsigned int)_InterlockedOr((long volatile *)(ptr), 0)
+    #define ATOMIC_STORE(ptr, value)    _InterlockedExchange((long volatile *)(ptr), (long)(value))
+#else
+    #define ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define ATOMIC_STORE(ptr, value)    __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
 #endif
 
-#define MAX_WAVE_SLOTS       10             // Number of wave slots for generation
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Wave generation worker, waves are generated on a background thread
+// NOTE: Only latest request is generated, in-flight obsolete requests are cancelled,
+// without SUPPORT_WAVE_WORKER requests are generated immediately
+typedef struct WaveWorker {
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxThread thread;           // Worker thread
+    RfxSemaphore lock;          // Worker shared state lock (binary semaphore)
+    RfxSemaphore signal;        // Worker wake-up signal (new request or quit)
+#endif
+    bool running;               // Worker thread running, otherwise requests generated immediately
+    unsigned int requestId;     // Latest request id, increased on every request or cancel
+    bool requested;             // Latest request waiting to be generated
+    bool quit;                  // Worker thread exit required
+    WaveParams params;          // Latest request wave parameters
+    int slot;                   // Latest request sound slot
+    bool draft;                 // Latest request generated as draft (lower quality, truncated)
+
+    float *frames;              // Generation frames buffer (max length), frames can be read while generating
+    unsigned int framesId;      // Generation request id
+    unsigned int framesCount;   // Generation frames available
+    bool framesDone;            // Generation finished or cancelled
+
+    bool ready;                 // Generated wave available, waiting to be swapped in
+    Wave wave;                  // Generated wave (32 bit float, mono)
+    int waveSlot;               // Generated wave sound slot
+    bool waveDraft;             // Generated wave is a draft
+} WaveWorker;
+
+// Wave peak, wave values summary for a block of frames
+typedef struct WavePeak {
+    float min;                  // Min value
+    float max;                  // Max value
+    float power;                // Mean square value (rms squared)
+} WavePeak;
+
+// Wave peaks pyramid, used for wave drawing at any resolution
+// NOTE: First level blocks are WAVE_PEAKS_BLOCK_FRAMES, every next level doubles block size,
+// all levels are allocated in one memory block (levels[0])
+typedef struct WavePeaks {
+    unsigned int frameCount;    // Wave frames count
+    int levelCount;             // Number of levels available
+    unsigned int count[WAVE_PEAKS_MAX_LEVELS];  // Peaks count per level
+    WavePeak *levels[WAVE_PEAKS_MAX_LEVELS];    // Peaks per level
+} WavePeaks;
+
+// Spectrogram worker, wave spectrogram computed on a background thread
+// NOTE: Only latest request is computed, result levels are converted to texture pixels by main thread
+typedef struct SpectrogramWorker {
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxThread thread;           // Worker thread
+    RfxSemaphore lock;          // Worker shared state lock (binary semaphore)
+    RfxSemaphore signal;        // Worker wake-up signal (new request or quit)
+#endif
+    bool running;               // Worker thread running, otherwise requests computed immediately
+    unsigned int requestId;     // Latest request id, increased on every request
+    bool requested;             // Latest request waiting to be computed
+    bool quit;                  // Worker thread exit required
+    Wave wave;                  // Latest request wave copy (32 bit float, mono), owned by worker
+
+    int width;                  // Spectrogram columns (time)
+    int height;                 // Spectrogram rows (frequency, top row is highest frequency)
+    float window[SPECTROGRAM_FFT_SIZE];             // FFT window (Hann)
+    float cosTable[SPECTROGRAM_FFT_SIZE/2];         // FFT twiddle factors, cos(2*PI*k/N)
+    float sinTable[SPECTROGRAM_FFT_SIZE/2];         // FFT twiddle factors, sin(2*PI*k/N)
+
+    bool ready;                 // Computed spectrogram available, waiting to be retrieved
+    unsigned char *levels;      // Computed spectrogram levels (width*height), 0 (min dB) to 255 (0 dB)
+} SpectrogramWorker;
+
+// Explore grid candidate, sound parameters and rendered preview
+typedef struct ExploreCandidate {
+    WaveParams params;          // Candidate wave parameters
+    WaveGenerator generator;    // Candidate generator, loaded before rendering (except noise waves)
+    int thread;                 // Candidate render thread index
+    unsigned int rendered;      // Candidate rendered, only written by render thread
+    Wave wave;                  // Rendered wave (32 bit float, mono), truncated preview
+    WavePeaks peaks;            // Rendered wave peaks, loaded by main thread for drawing
+} ExploreCandidate;
+
+// Explore grid render thread data
+typedef struct ExploreJob {
+    struct ExploreGrid *grid;   // Explore grid rendered
+    int thread;                 // Render thread index
+} ExploreJob;
+
+// Explore grid, candidate sounds rendered in parallel threads
+// NOTE: Every generator keeps its own random state (noise waves), candidates can be rendered
+// by any thread while wave worker and live voice are generating
+typedef struct ExploreGrid {
+    ExploreCandidate candidates[EXPLORE_MAX_CANDIDATES];    // Grid candidates
+    int count;                  // Candidates count
+    int threadCount;            // Render threads count
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxThread threads[RFXGEN_MAX_THREADS];  // Render threads
+    bool started[RFXGEN_MAX_THREADS];       // Render threads started, joined when finished
+#endif
+    ExploreJob jobs[RFXGEN_MAX_THREADS];    // Render threads data
+    unsigned int cancel;        // Rendering cancel required, only written by main thread
+} ExploreGrid;
+
+// Wave prefetch entry, generator button next result already rendered
+typedef struct WavePrefetchEntry {
+    WaveParams params;          // Entry wave parameters
+    WaveParams base;            // Entry base wave parameters (mutations only)
+    Wave wave;                  // Rendered wave (32 bit float, mono), full quality and length
+    WavePeaks peaks;            // Rendered wave peaks
+} WavePrefetchEntry;
+
+// Wave prefetch queues, next results of generator buttons rendered while idle
+// NOTE: Entries are rendered one by one by wave worker (WAVE_PREFETCH_SLOT requests), entries parameters
+// are generated from seeds derived from session seed, so results sequence does not depend on prefetching
+typedef struct WavePrefetch {
+    WavePrefetchEntry entries[WAVE_PREFETCH_SOURCES][WAVE_PREFETCH_QUEUE_SIZE];   // Rendered entries queues
+    int count[WAVE_PREFETCH_SOURCES];               // Rendered entries per source
+    unsigned int counter[WAVE_PREFETCH_SOURCES];    // Entries parameters generated per source, next seed
+    unsigned int seed;          // Session seed, entries seeds derived from it
+    bool enabled;               // Prefetching enabled, wave worker generating in background thread
+    bool pending;               // Entry requested, waiting for wave worker
+    int pendingSource;          // Entry requested source
+    WaveParams pendingParams;   // Entry requested wave parameters
+    WaveParams pendingBase;     // Entry requested base wave parameters (mutations only)
+} WavePrefetch;
+
+// Sound list entry, wave parameters always kept, wave rendered on demand
+typedef struct SoundEntry {
+    WaveParams params;          // Entry wave parameters
+    char name[64];              // Entry name (file name without extension), empty if not named
+    bool empty;                 // Entry not generated yet, not rendered until first generation
+    bool draft;                 // Entry wave is a draft, waiting for full quality regeneration
+    Wave wave;                  // Rendered wave (32 bit float, mono), no data if not rendered or evicted
+    WavePeaks peaks;            // Rendered wave peaks
+    unsigned int size;          // Rendered wave and peaks memory size (bytes)
+    unsigned int lastUsed;      // Frame entry was last current or visible, least recently used evicted first
+} SoundEntry;
+
+// Sound list, any number of sounds, rendered waves evicted under a memory budget
+// NOTE: Entries array is reallocated when list grows, entries must not be kept by pointer
+typedef struct SoundList {
+    SoundEntry *entries;        // Sound entries
+    int count;                  // Sound entries count
+    int capacity;               // Sound entries allocated
+    unsigned int memoryUsed;    // Rendered waves and peaks memory size (bytes)
+} SoundList;
+
+// Live voice, looping sound generated in real time by audio stream callback
+// NOTE: Parameters are sent by main thread through a lock-free single-producer/single-consumer
+// queue, audio thread only applies latest parameters available (no locks, no allocations)
+typedef struct LiveVoice {
+    WaveParams queue[LIVE_VOICE_QUEUE_SIZE];    // Parameters queue (ring buffer)
+    unsigned int writeIndex;    // Queue write index, only written by main thread
+    unsigned int readIndex;     // Queue read index, only written by audio thread
+    unsigned int stopRequest;   // Stop requested, only written by main thread
+    unsigned int stopped;       // Stop done (silence output), only written by audio thread
+    WaveGenerator generator;    // Wave generator, only used by audio thread while playing
+} LiveVoice;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -232,25 +444,77 @@ static char outFileName[512] = { 0 };       // Output file name (required for fi
 
 static float volumeValue = 0.6f;            // Master volume
 
+// NOTE: Global required, raylib audio stream callbacks do not provide user data
+static LiveVoice liveVoice = { .stopRequest = 1 };  // Live voice for sliders live preview
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
-#if defined(PLATFORM_DESKTOP)
-static void ShowCommandLineInfo(void);                      // Show command line usage info
-static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+// Auxiliar functions
+static WavePeaks LoadWavePeaks(Wave wave);                          // Load wave peaks pyramid from wave data (32bit float, mono)
+static void UnloadWavePeaks(WavePeaks peaks);                       // Unload wave peaks pyramid
+static WavePeak GetWavePeak(WavePeaks *peaks, Wave *wave, unsigned int start, unsigned int end); // Get wave peak for frames range
+static void DrawWavePeaks(WavePeaks *peaks, Wave *wave, unsigned int start, unsigned int end, Rectangle bounds, Color color); // Draw wave frames range using peaks
+static void UpdateSoundFromWave(Sound *sound, Wave wave, float **frames, unsigned int *framesSize); // Update sound from wave, audio buffer reused if wave fits
+static WaveParams GenSourceWaveParams(int source, WaveParams params);   // Generate wave parameters from source: presets, random or mutation
+
+// Sound list functions
+static int AddSoundEntry(SoundList *list, WaveParams params, const char *name, bool empty); // Add sound list entry (not rendered), returns entry index
+static void RemoveSoundEntry(SoundList *list, int index);           // Remove sound list entry, next entries moved
+static void SetSoundEntryWave(SoundList *list, int index, Wave wave, WavePeaks peaks, bool draft); // Set sound list entry rendered wave, ownership transferred
+static void UnloadSoundEntryWave(SoundList *list, int index);       // Unload sound list entry rendered wave, parameters kept
+static void EvictSoundList(SoundList *list, unsigned int budget, unsigned int frame); // Evict least recently used rendered waves until budget fits
+static void UnloadSoundList(SoundList *list);                       // Unload sound list entries
+
+// Wave generation worker functions
+static void InitWaveWorker(WaveWorker *worker);                     // Init wave worker, background thread started
+static unsigned int RequestWaveWorker(WaveWorker *worker, WaveParams params, int slot, bool draft); // Request wave generation, replaces any previous request
+static void CancelWaveWorker(WaveWorker *worker);                   // Cancel current request, in-flight generation is discarded
+static unsigned int GetWaveWorkerFrames(WaveWorker *worker, unsigned int id, unsigned int offset, float *frames, unsigned int frameCount, bool *finished); // Get request frames generated so far
+static bool GetWaveWorkerResult(WaveWorker *worker, Wave *wave, int *slot, bool *draft); // Get generated wave if ready, wave ownership transferred
+static void CloseWaveWorker(WaveWorker *worker);                    // Close wave worker, waiting for thread to finish
+static bool GenerateWaveWorker(WaveWorker *worker, WaveParams params, unsigned int id, bool draft, Wave *wave); // Generate wave, checking for cancellation between blocks
+#if defined(SUPPORT_WAVE_WORKER)
+static void WaveWorkerThread(void *data);                           // Wave worker thread function
 #endif
 
-// Auxiliar functions
-static void DrawWave(Wave *wave, Rectangle bounds, Color color);    // Draw wave data using lines
+// Spectrogram worker functions
+static void InitSpectrogramWorker(SpectrogramWorker *worker, int width, int height); // Init spectrogram worker, background thread started
+static void RequestSpectrogramWorker(SpectrogramWorker *worker, Wave wave); // Request wave spectrogram, replaces any previous request
+static bool GetSpectrogramWorkerResult(SpectrogramWorker *worker, unsigned char **levels); // Get computed levels if ready, levels ownership transferred
+static void CloseSpectrogramWorker(SpectrogramWorker *worker);      // Close spectrogram worker, waiting for thread to finish
+static bool ComputeSpectrogram(SpectrogramWorker *worker, Wave wave, unsigned int id, unsigned char *levels); // Compute spectrogram levels, checking for cancellation between columns
+static void ComputeSpectrum(SpectrogramWorker *worker, float *re, float *im, float *power); // Compute power spectrum of one window (real FFT)
+#if defined(SUPPORT_WAVE_WORKER)
+static void SpectrogramWorkerThread(void *data);                    // Spectrogram worker thread function
+#endif
 
-#if defined(PLATFORM_DESKTOP)
-static void WaitTimePlayer(int ms);             // Simple time wait in milliseconds for the CLI player
-static void PlayWaveCLI(Wave wave);             // Play provided wave through CLI
-#if !defined(_WIN32)
-static int kbhit(void);                         // Check if key has been pressed
-static char getch(void) { return getchar(); }   // Get pressed character
+// Explore grid functions
+static void StartExploreGrid(ExploreGrid *grid, int source, WaveParams params, int count); // Start explore grid candidates generation and rendering
+static bool UpdateExploreGrid(ExploreGrid *grid);                   // Update explore grid, returns true while rendering
+static void UnloadExploreGrid(ExploreGrid *grid);                   // Unload explore grid candidates, rendering cancelled
+static Rectangle GetExploreCandidateBounds(Rectangle bounds, int count, int index); // Get explore grid candidate bounds
+static void RenderExploreCandidates(ExploreGrid *grid, int thread); // Render explore grid candidates assigned to thread
+#if defined(SUPPORT_WAVE_WORKER)
+static void ExploreGridThread(void *data);                          // Explore grid render thread function
 #endif
-#endif // PLATFORM_DESKTOP
+
+// Wave prefetch functions
+static void InitWavePrefetch(WavePrefetch *prefetch, bool enabled); // Init wave prefetch queues, session seed set
+static WaveParams GenWavePrefetchParams(WavePrefetch *prefetch, int source, WaveParams base); // Generate source next wave parameters (seeded)
+static bool IsWavePrefetchFull(WavePrefetch *prefetch, WaveParams base); // Check if all queues are rendered (mutations of base) or disabled
+static bool RequestWavePrefetch(WavePrefetch *prefetch, WaveWorker *worker, WaveParams base); // Request next missing entry rendering to wave worker
+static void CancelWavePrefetch(WavePrefetch *prefetch, WaveWorker *worker); // Cancel requested entry, rendered again later
+static void StoreWavePrefetch(WavePrefetch *prefetch, Wave wave);   // Store requested entry rendered wave, ownership transferred
+static bool PopWavePrefetch(WavePrefetch *prefetch, int source, WaveParams base, WavePrefetchEntry *entry); // Get source next entry if rendered, ownership transferred
+static void UnloadWavePrefetch(WavePrefetch *prefetch);             // Unload wave prefetch entries
+
+// Live voice functions
+static void StartLiveVoice(LiveVoice *voice, AudioStream stream, WaveParams params); // Start live voice, audio stream must be stopped
+static bool PushLiveVoiceParams(LiveVoice *voice, WaveParams params); // Push live voice parameters to queue, returns false if queue is full
+static void StopLiveVoice(LiveVoice *voice);                        // Request live voice stop, silence output from next audio callback
+static bool IsLiveVoiceStopped(LiveVoice *voice);                   // Check if live voice stop is done by audio thread
+static void LiveVoiceCallback(void *buffer, unsigned int frames);   // Live voice audio stream callback (audio thread)
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -276,8 +540,7 @@ int main(int argc, char *argv[])
         }
         else
         {
-            ProcessCommandLine(argc, argv);
-            return 0;
+            return ProcessCommandLine(argc, argv);
         }
     }
 #endif // PLATFORM_DESKTOP
@@ -303,6 +566,7 @@ int main(int argc, char *argv[])
     // GUI: Main Layout
     //-----------------------------------------------------------------------------------
     bool playOnChange = true;           // Automatically play sound on parameter change
+    bool livePreview = true;            // Play sound in real time while sliders are dragged
     bool screenSizeDouble = false;      // Scale screen x2 (useful for HighDPI screens)
     //-----------------------------------------------------------------------------------
 
@@ -350,6 +614,34 @@ int main(int argc, char *argv[])
     int exportChannels = 1;         // Export wave channels
     //-----------------------------------------------------------------------------------
 
+    // GUI: Explore Window
+    //-----------------------------------------------------------------------------------
+    bool showExploreWindow = false;
+
+    int exploreSourceActive = 7;    // ToggleGroup candidates source selection (Random)
+    int exploreCountActive = 0;     // ToggleGroup candidates count selection (16, 32, 64)
+    int exploreCursor = -1;         // Candidate selected (mouse hover or keyboard)
+    bool exploreRequest = false;    // Candidates generation requested, waiting for wave generation to finish
+    bool exploreRendering = false;  // Candidates rendering in progress
+
+    // NOTE: Grid is accessed by pointer from render threads, it must not be moved
+    static ExploreGrid exploreGrid = { 0 };
+    Sound exploreSound = { 0 };     // Candidates preview sound, audio buffer reused
+    //-----------------------------------------------------------------------------------
+
+    // GUI: Sound List Window
+    //-----------------------------------------------------------------------------------
+    bool showSoundListWindow = false;
+
+    Vector2 listScroll = { 0 };     // Sound list scroll offset
+    Rectangle listView = { 0 };     // Sound list visible area, only visible rows are drawn and rendered
+    int listFirst = 0;              // Sound list first visible row
+    int listLast = -1;              // Sound list last visible row
+    int listRendering = -1;         // Sound list entry rendering by wave worker, -1 if none
+    bool listPlay = false;          // Play current entry once rendered (selected while not rendered)
+    bool listRemoveRequest = false; // Remove current entry requested
+    //-----------------------------------------------------------------------------------
+
     // GUI: Exit Window
     //-----------------------------------------------------------------------------------
     bool closeWindow = false;
@@ -365,62 +657,120 @@ int main(int argc, char *argv[])
 
     // Wave and Sound Initialization
     //-----------------------------------------------------------------------------------
-    WaveParams params[MAX_WAVE_SLOTS] = { 0 }; // Wave parameters for generation
-    Wave wave[MAX_WAVE_SLOTS] = { 0 };
-    Sound sound[MAX_WAVE_SLOTS] = { 0 };
+    // Sound list, any number of entries, only current entry and visible rows are rendered
+    // NOTE: Rendered waves are evicted (least recently used) when memory budget is exceeded
+    SoundList soundList = { 0 };
+    unsigned int frameCounter = 0;              // Frames counter, entries last use
 
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++)
-    {
-        // Reset generation parameters
-        // NOTE: Random seed for generation is set
-        ResetWaveParams(&params[i]);
-
-        // Default wave values
-        wave[i].sampleRate = RFXGEN_GEN_SAMPLE_RATE;
-        wave[i].sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
-        wave[i].channels = RFXGEN_GEN_CHANNELS;
-        wave[i].frameCount = 10*wave[i].sampleRate;    // Max frame count for 10 seconds
-        wave[i].data = (float *)RL_CALLOC(wave[i].frameCount, sizeof(float));
-
-        sound[i] = LoadSoundFromWave(wave[i]);
-    }
+    // Reset generation parameters, used by new entries
+    // NOTE: Random seed for generation is set
+    WaveParams defaultParams = { 0 };
+    ResetWaveParams(&defaultParams);
+
+    // NOTE: Entries are empty (no wave data) until first generation
+    AddSoundEntry(&soundList, defaultParams, NULL, true);
+
+    // Current entry sound, audio buffer reused when new wave fits
+    Sound sound = { 0 };
+
+    // Sound update frames, wave converted to sound format before updating sound audio buffer
+    float *soundFrames = NULL;
+    unsigned int soundFramesSize = 0;
     //-----------------------------------------------------------------------------------
 
     // Check if wave parameters file has been provided on command line
     if (inFileName[0] != '\0')
     {
-        // Clean everything (just in case)
-        UnloadWave(wave[0]);
-        UnloadSound(sound[0]);
-
-        params[0] = LoadWaveParams(inFileName); // Load wave parameters from .rfx
+        soundList.entries[0].params = LoadWaveParams(inFileName); // Load wave parameters from .rfx
+        strncpy(soundList.entries[0].name, GetFileNameWithoutExt(inFileName), sizeof(soundList.entries[0].name) - 1);
 
         // NOTE: GenerateWave() returns data as 32bit float, 1 channel by default
-        wave[0].sampleRate = RFXGEN_GEN_SAMPLE_RATE;
-        wave[0].sampleSize = 32;
-        wave[0].channels = 1;
-        wave[0].data = GenerateWave(params[0], &wave[0].frameCount);
+        Wave wave = { 0 };
+        wave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+        wave.sampleSize = 32;
+        wave.channels = 1;
+        wave.data = GenerateWave(soundList.entries[0].params, &wave.frameCount);
 
-        sound[0] = LoadSoundFromWave(wave[0]);  // Load sound from new wave
+        SetSoundEntryWave(&soundList, 0, wave, LoadWavePeaks(wave), false);
+        sound = LoadSoundFromWave(wave);        // Load sound from new wave
 
-        PlaySound(sound[0]);                    // Play generated sound
+        PlaySound(sound);                       // Play generated sound
     }
 
+    bool waveRedraw = true;                     // Wave render texture redraw required
+    int waveTextColor = 0;                      // Wave render texture drawn style color
+    int waveBackColor = 0;                      // Wave render texture drawn style background color
+
     bool regenerate = false;                    // Wave regeneration required
+    bool generating = false;                    // Wave generation requested, waiting for worker
+
+    // Draft waves, generated faster while interacting (sliders, presets), regenerated at full quality once idle
+    // NOTE: Entry wave draft flag is set when draft is swapped in
+    double requestTime = -WAVE_DRAFT_IDLE_TIME; // Latest wave generation request time
+
+    // Wave generation worker, generating on a background thread
+    // NOTE: Worker is accessed by pointer from thread, it must not be moved
+    static WaveWorker worker = { 0 };
+    InitWaveWorker(&worker);
+
+    // Generator buttons next results, rendered by wave worker while idle and swapped in when pressed
+    WavePrefetch prefetch = { 0 };
+    InitWavePrefetch(&prefetch, worker.running);
+    int sourcePressed = -1;                     // Generator button pressed (source), processed on next frame
+
+    // Progressive playback, generated frames are played by an audio stream while generating
+    // NOTE: Sub-buffers are only updated when filled (or wave ended), avoiding silence gaps
+    SetAudioStreamBufferSizeDefault(WAVE_STREAM_BUFFER_FRAMES);
+    AudioStream stream = LoadAudioStream(RFXGEN_GEN_SAMPLE_RATE, 32, 1);
+    SetAudioStreamVolume(stream, volumeValue);
+
+    float streamFrames[WAVE_STREAM_BUFFER_FRAMES] = { 0 };
+    unsigned int streamId = 0;                  // Wave worker request id streamed
+    unsigned int streamPosition = 0;            // Wave worker request frames already streamed
+    int streamDrain = 0;                        // Sub-buffers played after wave end, stream stopped after last one
+    bool streaming = false;                     // Audio stream playing generated frames
+    bool eventWaiting = true;                   // Waiting for input events, disabled while generating or streaming
+
+    // Live preview, looping sound generated in audio thread while sliders are dragged
+    // NOTE: Smaller sub-buffers than progressive playback, parameters changes are heard sooner
+    SetAudioStreamBufferSizeDefault(LIVE_VOICE_BUFFER_FRAMES);
+    AudioStream liveStream = LoadAudioStream(RFXGEN_GEN_SAMPLE_RATE, 32, 1);
+    SetAudioStreamCallback(liveStream, LiveVoiceCallback);
+    SetAudioStreamVolume(liveStream, volumeValue);
+
+    WaveParams liveParams = { 0 };              // Live voice latest parameters sent
+    bool liveActive = false;                    // Live voice playing, sliders dragged
+    bool liveStopping = false;                  // Live voice stop requested, waiting for audio thread
+    int liveStopFrames = 0;                     // Frames waiting for live voice stop
 
     float prevVolumeValue = volumeValue;
-    int prevWaveTypeValue[MAX_WAVE_SLOTS] = { params[0].waveTypeValue };
+    int prevWaveTypeValue = soundList.entries[0].params.waveTypeValue;
 
-    Rectangle waveRec = { 12, 484, 616, 64 };       // Wave drawing rectangle box
+    Rectangle waveRec = { 12, 484, 302, 64 };       // Wave drawing rectangle box
+    Rectangle spectrogramRec = { 326, 484, 302, 64 };   // Spectrogram drawing rectangle box
     Rectangle slidersRec = { 256, 82, 226, 392 };   // Area defining sliders to allow sound replay when mouse-released
+    Rectangle exploreGridRec = { 16, 132, 608, 412 };   // Explore window candidates grid box
 
     // Set default sound volume
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++) SetSoundVolume(sound[i], volumeValue);
+    SetSoundVolume(sound, volumeValue);
 
     // Render texture to draw wave at x2, it will be scaled down with bilinear filtering (cheapre than MSAA x4)
     RenderTexture2D waveTarget = LoadRenderTexture((int)waveRec.width*2, (int)waveRec.height*2);
     SetTextureFilter(waveTarget.texture, TEXTURE_FILTER_BILINEAR);
 
+    // Spectrogram texture at x2, levels computed by spectrogram worker and colored by main thread
+    // NOTE: Worker is accessed by pointer from thread, it must not be moved
+    static SpectrogramWorker spectrogramWorker = { 0 };
+    InitSpectrogramWorker(&spectrogramWorker, (int)spectrogramRec.width*2, (int)spectrogramRec.height*2);
+
+    Image spectrogramImage = GenImageColor(spectrogramWorker.width, spectrogramWorker.height, BLANK);
+    Texture2D spectrogramTexture = LoadTextureFromImage(spectrogramImage);
+    SetTextureFilter(spectrogramTexture, TEXTURE_FILTER_BILINEAR);
+
+    unsigned char *spectrogramLevels = NULL;    // Spectrogram levels displayed
+    bool spectrogramPending = false;            // Spectrogram requested, waiting for worker
+    bool spectrogramRedraw = true;              // Spectrogram texture update required
+
     // Render texture to draw full screen, enables screen scaling
     // NOTE: If screen is scaled, mouse input should be scaled proportionally
     RenderTexture2D screenTarget = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
@@ -458,10 +808,31 @@ int main(int argc, char *argv[])
         {
             FilePathList droppedFiles = LoadDroppedFiles();
 
+            // Support loading several .rfx files, added as new entries (files read in parallel)
+            // NOTE: Entries are rendered when shown, files failing to load are skipped
+            if ((droppedFiles.count > 1) && IsFileExtension(droppedFiles.paths[0], ".rfx"))
+            {
+                WaveParamsList paramsList = LoadWaveParamsList((const char **)droppedFiles.paths, droppedFiles.count);
+                int firstIndex = soundList.count;
+
+                for (unsigned int i = 0; i < paramsList.count; i++)
+                {
+                    if (paramsList.errors[i] == RFXGEN_LOAD_SUCCESS) AddSoundEntry(&soundList, paramsList.params[i], GetFileNameWithoutExt(droppedFiles.paths[i]), false);
+                }
+
+                UnloadWaveParamsList(paramsList);
+
+                if (soundList.count > firstIndex)
+                {
+                    mainToolbarState.soundSlotActive = firstIndex;
+                    if (!showExploreWindow) showSoundListWindow = true;
+                }
+            }
             // Support loading .rfx files (wave parameters)
-            if (IsFileExtension(droppedFiles.paths[0], ".rfx")) // || IsFileExtension(droppedFiles.paths[0], ".sfs"))
+            else if (IsFileExtension(droppedFiles.paths[0], ".rfx")) // || IsFileExtension(droppedFiles.paths[0], ".sfs"))
             {
-                params[mainToolbarState.soundSlotActive] = LoadWaveParams(droppedFiles.paths[0]);
+                soundList.entries[mainToolbarState.soundSlotActive].params = LoadWaveParams(droppedFiles.paths[0]);
+                strncpy(soundList.entries[mainToolbarState.soundSlotActive].name, GetFileNameWithoutExt(droppedFiles.paths[0]), sizeof(soundList.entries[0].name) - 1);
                 regenerate = true;
 
                 SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(droppedFiles.paths[0])));
@@ -487,25 +858,66 @@ int main(int argc, char *argv[])
         // Show dialog: export wave (.wav, .qoa, .raw, .h)
         if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_E)) showExportWindow = true;
 
-        if (!showSaveFileDialog)
+        // Copy sound to clipboard as share text (parameters encoded, 12 bit quantized)
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_C))
+        {
+            char shareText[RFXGEN_PARAMS_TEXT_MAX_SIZE] = { 0 };
+            if (EncodeWaveParamsText(soundList.entries[mainToolbarState.soundSlotActive].params, 12, shareText) > 0) SetClipboardText(shareText);
+        }
+
+        // Paste sound from clipboard share text
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_V))
+        {
+            const char *shareText = GetClipboardText();
+            WaveParams sharedParams = { 0 };
+
+            if ((shareText != NULL) && DecodeWaveParamsText(shareText, &sharedParams))
+            {
+                soundList.entries[mainToolbarState.soundSlotActive].params = sharedParams;
+                regenerate = true;
+            }
+        }
+
+        if (!showSaveFileDialog && !showExploreWindow && !mainToolbarState.soundSlotEditMode)
         {
-            // Select current sound slot
-            if (IsKeyPressed(KEY_ONE)) mainToolbarState.soundSlotActive = 0;
-            else if (IsKeyPressed(KEY_TWO)) mainToolbarState.soundSlotActive = 1;
-            else if (IsKeyPressed(KEY_THREE)) mainToolbarState.soundSlotActive = 2;
-            else if (IsKeyPressed(KEY_FOUR)) mainToolbarState.soundSlotActive = 3;
-            else if (IsKeyPressed(KEY_FIVE)) mainToolbarState.soundSlotActive = 4;
-            else if (IsKeyPressed(KEY_SIX)) mainToolbarState.soundSlotActive = 5;
-            else if (IsKeyPressed(KEY_SEVEN)) mainToolbarState.soundSlotActive = 6;
-            else if (IsKeyPressed(KEY_EIGHT)) mainToolbarState.soundSlotActive = 7;
-            else if (IsKeyPressed(KEY_NINE)) mainToolbarState.soundSlotActive = 8;
-            else if (IsKeyPressed(KEY_ZERO)) mainToolbarState.soundSlotActive = 9;
+            // Select current sound, first ten entries
+            int soundKey = -1;
+            if (IsKeyPressed(KEY_ONE)) soundKey = 0;
+            else if (IsKeyPressed(KEY_TWO)) soundKey = 1;
+            else if (IsKeyPressed(KEY_THREE)) soundKey = 2;
+            else if (IsKeyPressed(KEY_FOUR)) soundKey = 3;
+            else if (IsKeyPressed(KEY_FIVE)) soundKey = 4;
+            else if (IsKeyPressed(KEY_SIX)) soundKey = 5;
+            else if (IsKeyPressed(KEY_SEVEN)) soundKey = 6;
+            else if (IsKeyPressed(KEY_EIGHT)) soundKey = 7;
+            else if (IsKeyPressed(KEY_NINE)) soundKey = 8;
+            else if (IsKeyPressed(KEY_ZERO)) soundKey = 9;
+
+            if ((soundKey >= 0) && (soundKey < soundList.count)) mainToolbarState.soundSlotActive = soundKey;
 
             // Play current sound
-            if (IsKeyPressed(KEY_SPACE)) PlaySound(sound[mainToolbarState.soundSlotActive]);
+            if (IsKeyPressed(KEY_SPACE))
+            {
+                StopAudioStream(stream);
+                streaming = false;
+                PlaySound(sound);
+            }
 
             // Toggle play on change option
             if (IsKeyPressed(KEY_P)) playOnChange = !playOnChange;
+
+            // Toggle live preview option
+            if (IsKeyPressed(KEY_L)) livePreview = !livePreview;
+
+            // Show explore window, candidates generated on open
+            if (!IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_E) && !showSoundListWindow)
+            {
+                showExploreWindow = true;
+                exploreRequest = true;
+            }
+
+            // Toggle sounds list window
+            if (IsKeyPressed(KEY_TAB)) showSoundListWindow = !showSoundListWindow;
         }
 
         // Select visual style
@@ -534,6 +946,8 @@ int main(int argc, char *argv[])
             else if (windowHelpState.windowActive) windowHelpState.windowActive = false;
             else if (showIssueReportWindow) showIssueReportWindow = false;
             else if (showSupportMessage) showSupportMessage = false;
+            else if (showExploreWindow) showExploreWindow = false;
+            else if (showSoundListWindow) showSoundListWindow = false;
             else if (showExportWindow) showExportWindow = false;
         #if defined(PLATFORM_DESKTOP)
             else showExitWindow = !showExitWindow;
@@ -550,12 +964,21 @@ int main(int argc, char *argv[])
         // File options logic
         if (mainToolbarState.btnNewFilePressed)
         {
-            // Reload current slot
-            UnloadSound(sound[mainToolbarState.soundSlotActive]);
-            UnloadWave(wave[mainToolbarState.soundSlotActive]);
+            // Cancel any wave generation in progress, it would replace reset entry
+            CancelWavePrefetch(&prefetch, &worker);
+            CancelWaveWorker(&worker);
+            generating = false;
+
+            StopAudioStream(stream);
+            streaming = false;
 
-            wave[mainToolbarState.soundSlotActive].data = (float *)RL_CALLOC(wave[mainToolbarState.soundSlotActive].frameCount, sizeof(float));
-            sound[mainToolbarState.soundSlotActive] = LoadSoundFromWave(wave[mainToolbarState.soundSlotActive]);
+            // Empty current entry, wave and sound are loaded again on next generation
+            UnloadSound(sound);
+            sound = (Sound){ 0 };
+
+            UnloadSoundEntryWave(&soundList, mainToolbarState.soundSlotActive);
+            soundList.entries[mainToolbarState.soundSlotActive].empty = true;
+            waveRedraw = true;
         }
         else if (mainToolbarState.btnLoadFilePressed) showLoadFileDialog = true;
         else if (mainToolbarState.btnSaveFilePressed)
@@ -565,6 +988,14 @@ int main(int argc, char *argv[])
         }
         else if (mainToolbarState.btnExportFilePressed) showExportWindow = true;
 
+        // Edit options logic
+        if (mainToolbarState.btnAddSoundPressed)
+        {
+            int index = AddSoundEntry(&soundList, defaultParams, NULL, true);
+            if (index >= 0) mainToolbarState.soundSlotActive = index;
+        }
+        else if (mainToolbarState.btnSoundListPressed) showSoundListWindow = true;
+
         if (mainToolbarState.visualStyleActive != mainToolbarState.prevVisualStyleActive)
         {
             // Reset to default internal style
@@ -599,11 +1030,220 @@ int main(int argc, char *argv[])
             prevVolumeValue = volumeValue;
         }
 
+        // Check current entry change to play next one selected
+        // NOTE: Sound is updated from entry wave if rendered, otherwise entry is rendered first
+        if (mainToolbarState.soundSlotActive != mainToolbarState.prevSoundSlotActive)
+        {
+            StopSound(sound);
+            StopAudioStream(stream);
+            streaming = false;
+
+            if (soundList.entries[mainToolbarState.soundSlotActive].wave.data != NULL)
+            {
+                UpdateSoundFromWave(&sound, soundList.entries[mainToolbarState.soundSlotActive].wave, &soundFrames, &soundFramesSize);
+                PlaySound(sound);
+                listPlay = false;
+            }
+            else
+            {
+                UnloadSound(sound);
+                sound = (Sound){ 0 };
+
+                // Not rendered entry (evicted or loaded) is rendered and played, by sound list window if shown
+                // NOTE: Previous entry generation in progress is replaced, previous entry rendered again when shown
+                if (!soundList.entries[mainToolbarState.soundSlotActive].empty)
+                {
+                    if (showSoundListWindow) listPlay = true;
+                    else
+                    {
+                        if (generating && (mainToolbarState.prevSoundSlotActive >= 0) &&
+                            (mainToolbarState.prevSoundSlotActive < soundList.count)) UnloadSoundEntryWave(&soundList, mainToolbarState.prevSoundSlotActive);
+                        regenerate = true;
+                    }
+                }
+            }
+
+            prevWaveTypeValue = soundList.entries[mainToolbarState.soundSlotActive].params.waveTypeValue;
+            mainToolbarState.prevSoundSlotActive = mainToolbarState.soundSlotActive;
+            waveRedraw = true;
+        }
+
+        // Current entry used on this frame, not evicted
+        frameCounter++;
+        soundList.entries[mainToolbarState.soundSlotActive].lastUsed = frameCounter;
+
         // Check wave type combobox selection to regenerate wave
-        if (params[mainToolbarState.soundSlotActive].waveTypeValue != prevWaveTypeValue[mainToolbarState.soundSlotActive]) regenerate = true;
-        prevWaveTypeValue[mainToolbarState.soundSlotActive] = params[mainToolbarState.soundSlotActive].waveTypeValue;
+        if (soundList.entries[mainToolbarState.soundSlotActive].params.waveTypeValue != prevWaveTypeValue) regenerate = true;
+        prevWaveTypeValue = soundList.entries[mainToolbarState.soundSlotActive].params.waveTypeValue;
 
         // Avoid wave regeneration when some window is active
+        // Explore window logic, candidates rendered in parallel and played on selection
+        if (showExploreWindow)
+        {
+            // Candidates rendering started, prefetch rendering cancelled (processors used by candidates)
+            if (exploreRequest)
+            {
+                CancelWavePrefetch(&prefetch, &worker);
+                StartExploreGrid(&exploreGrid, exploreSourceActive, soundList.entries[mainToolbarState.soundSlotActive].params, 16 << exploreCountActive);
+                exploreRequest = false;
+                exploreCursor = -1;
+            }
+
+            exploreRendering = UpdateExploreGrid(&exploreGrid);
+
+            // Select candidate with mouse or keyboard, candidate is played when selected
+            int prevExploreCursor = exploreCursor;
+            int exploreColumns = (exploreGrid.count <= 16)? 4 : 8;
+
+            for (int i = 0; i < exploreGrid.count; i++)
+            {
+                if (CheckCollisionPointRec(GetMousePosition(), GetExploreCandidateBounds(exploreGridRec, exploreGrid.count, i)) &&
+                    ((GetMouseDelta().x != 0.0f) || (GetMouseDelta().y != 0.0f) || IsMouseButtonPressed(MOUSE_LEFT_BUTTON))) exploreCursor = i;
+            }
+
+            if (exploreGrid.count > 0)
+            {
+                if (exploreCursor < 0) { if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_UP)) exploreCursor = 0; }
+                else if (IsKeyPressed(KEY_RIGHT) && (exploreCursor < (exploreGrid.count - 1))) exploreCursor++;
+                else if (IsKeyPressed(KEY_LEFT) && (exploreCursor > 0)) exploreCursor--;
+                else if (IsKeyPressed(KEY_DOWN) && ((exploreCursor + exploreColumns) < exploreGrid.count)) exploreCursor += exploreColumns;
+                else if (IsKeyPressed(KEY_UP) && (exploreCursor >= exploreColumns)) exploreCursor -= exploreColumns;
+            }
+
+            if ((exploreCursor >= 0) && (exploreCursor < exploreGrid.count) &&
+                ((exploreCursor != prevExploreCursor) || IsKeyPressed(KEY_SPACE)) &&
+                ATOMIC_LOAD(&exploreGrid.candidates[exploreCursor].rendered))
+            {
+                StopSound(sound);
+                StopAudioStream(stream);
+                streaming = false;
+
+                UpdateSoundFromWave(&exploreSound, exploreGrid.candidates[exploreCursor].wave, &soundFrames, &soundFramesSize);
+                PlaySound(exploreSound);
+            }
+
+            // Pick selected candidate into current sound, regenerated at full length
+            if ((exploreCursor >= 0) && (exploreCursor < exploreGrid.count) &&
+                (IsKeyPressed(KEY_ENTER) || (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) &&
+                CheckCollisionPointRec(GetMousePosition(), GetExploreCandidateBounds(exploreGridRec, exploreGrid.count, exploreCursor)))))
+            {
+                soundList.entries[mainToolbarState.soundSlotActive].params = exploreGrid.candidates[exploreCursor].params;
+                regenerate = true;
+                showExploreWindow = false;
+            }
+        }
+
+        // Explore window closed, candidates unloaded (rendering cancelled)
+        if (!showExploreWindow && (exploreGrid.count > 0))
+        {
+            StopSound(exploreSound);
+            UnloadExploreGrid(&exploreGrid);
+            exploreRendering = false;
+            exploreRequest = false;
+        }
+
+        // Sound list window logic, entries selected and played, visible entries rendered on demand
+        if (showSoundListWindow)
+        {
+            // Remove current entry, wave generation in progress cancelled (entries indices change)
+            if (listRemoveRequest && (soundList.count > 1))
+            {
+                CancelWavePrefetch(&prefetch, &worker);
+                CancelWaveWorker(&worker);
+                generating = false;
+                listRendering = -1;
+
+                StopSound(sound);
+                StopAudioStream(stream);
+                streaming = false;
+
+                RemoveSoundEntry(&soundList, mainToolbarState.soundSlotActive);
+                if (mainToolbarState.soundSlotActive >= soundList.count) mainToolbarState.soundSlotActive = soundList.count - 1;
+                mainToolbarState.prevSoundSlotActive = -1;  // Force current entry sound update
+            }
+
+            listRemoveRequest = false;
+
+            // Visible rows used on this frame, not evicted
+            // NOTE: Visible rows range is updated on list drawing
+            if (listLast > (soundList.count - 1)) listLast = soundList.count - 1;
+            for (int i = listFirst; i <= listLast; i++) soundList.entries[i].lastUsed = frameCounter;
+
+            // Select entry with mouse or keyboard, entry is played when selected
+            int prevSoundSlotActive = mainToolbarState.soundSlotActive;
+
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(GetMousePosition(), listView))
+            {
+                int row = (int)((GetMousePosition().y - listView.y - listScroll.y)/SOUND_LIST_ROW_HEIGHT);
+                if ((row >= 0) && (row < soundList.count)) mainToolbarState.soundSlotActive = row;
+            }
+            else if (IsKeyPressed(KEY_DOWN) && (mainToolbarState.soundSlotActive < (soundList.count - 1))) mainToolbarState.soundSlotActive++;
+            else if (IsKeyPressed(KEY_UP) && (mainToolbarState.soundSlotActive > 0)) mainToolbarState.soundSlotActive--;
+
+            if (mainToolbarState.soundSlotActive != prevSoundSlotActive)
+            {
+                soundList.entries[mainToolbarState.soundSlotActive].lastUsed = frameCounter;
+
+                // Keep selected entry row visible
+                float rowY = (float)mainToolbarState.soundSlotActive*SOUND_LIST_ROW_HEIGHT;
+                if (rowY < -listScroll.y) listScroll.y = -rowY;
+                else if ((rowY + SOUND_LIST_ROW_HEIGHT) > (-listScroll.y + listView.height)) listScroll.y = -(rowY + SOUND_LIST_ROW_HEIGHT - listView.height);
+            }
+
+            if (IsKeyPressed(KEY_ENTER)) showSoundListWindow = false;
+        }
+
+        // Sound list window closed, entry rendering cancelled, current entry rendered if not done yet
+        if (!showSoundListWindow && ((listRendering >= 0) || listPlay))
+        {
+            if (listRendering >= 0) CancelWaveWorker(&worker);
+            listRendering = -1;
+
+            if (listPlay) regenerate = true;
+            listPlay = false;
+        }
+
+        // Generator buttons logic, next result swapped in with no generation if already rendered
+        // NOTE: Otherwise same next parameters are generated and wave is regenerated
+        if (sourcePressed >= 0)
+        {
+            WavePrefetchEntry entry = { 0 };
+
+            if (PopWavePrefetch(&prefetch, sourcePressed, soundList.entries[mainToolbarState.soundSlotActive].params, &entry))
+            {
+                // Cancel wave generation in progress, it would replace swapped wave
+                // NOTE: Prefetch requests are only done while not generating, in-flight entry is kept
+                if (generating)
+                {
+                    CancelWaveWorker(&worker);
+                    generating = false;
+                }
+
+                StopSound(sound);
+                StopAudioStream(stream);
+                streaming = false;
+
+                soundList.entries[mainToolbarState.soundSlotActive].params = entry.params;
+                prevWaveTypeValue = entry.params.waveTypeValue;
+
+                SetSoundEntryWave(&soundList, mainToolbarState.soundSlotActive, entry.wave, entry.peaks, false);
+
+                UpdateSoundFromWave(&sound, entry.wave, &soundFrames, &soundFramesSize);
+                PlaySound(sound);
+
+                waveRedraw = true;
+            }
+            else
+            {
+                // Wave generation in progress is replaced by new parameters request
+                CancelWavePrefetch(&prefetch, &worker);
+                soundList.entries[mainToolbarState.soundSlotActive].params = GenWavePrefetchParams(&prefetch, sourcePressed, soundList.entries[mainToolbarState.soundSlotActive].params);
+                regenerate = true;
+            }
+
+            sourcePressed = -1;
+        }
+
         if (!windowHelpState.windowActive &&
             !windowAboutState.windowActive &&
             !showIssueReportWindow &&
@@ -612,42 +1252,171 @@ int main(int argc, char *argv[])
             !showSaveFileDialog &&
             !showExportFileDialog &&
             !showExportWindow &&
+            !showExploreWindow &&
+            !showSoundListWindow &&
             !showExitWindow)
         {
+            // Start live preview when sliders are pressed, wave generation in progress is cancelled
+            // NOTE: Wave is regenerated with final parameters once live voice is stopped
+            if (livePreview && !liveActive && !liveStopping &&
+                (CheckCollisionPointRec(GetMousePosition(), slidersRec)) && (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)))
+            {
+                StopSound(sound);
+                StopAudioStream(stream);
+                streaming = false;
+
+                CancelWavePrefetch(&prefetch, &worker);
+                if (generating)
+                {
+                    CancelWaveWorker(&worker);
+                    generating = false;
+                }
+                liveParams = soundList.entries[mainToolbarState.soundSlotActive].params;
+                StartLiveVoice(&liveVoice, liveStream, liveParams);
+                liveActive = true;
+            }
+
             // Consider two possible cases to regenerate wave and update sound:
             // CASE1: regenerate flag is true (set by sound buttons functions)
             // CASE2: Mouse is moving sliders and mouse is released (checks against slidersRec)
-            if (regenerate || ((CheckCollisionPointRec(GetMousePosition(), slidersRec)) && (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))))
+            // NOTE: With live preview, wave is regenerated once live voice is stopped
+            if (!liveActive && !liveStopping &&
+                (regenerate || ((CheckCollisionPointRec(GetMousePosition(), slidersRec)) && (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)))))
             {
-                UnloadWave(wave[mainToolbarState.soundSlotActive]);
-                UnloadSound(sound[mainToolbarState.soundSlotActive]);
+                // Request new wave generation from parameters, current sound is kept until new one is ready
+                // NOTE: Requests close to previous one (user interacting) are generated as drafts
+                bool draft = ((GetTime() - requestTime) < WAVE_DRAFT_IDLE_TIME);
+                requestTime = GetTime();
 
-                // Generate new wave from parameters
-                // NOTE: GenerateWave() returns data as 32bit float, 1 channel by default
-                wave[mainToolbarState.soundSlotActive].sampleRate = RFXGEN_GEN_SAMPLE_RATE;
-                wave[mainToolbarState.soundSlotActive].sampleSize = 32;
-                wave[mainToolbarState.soundSlotActive].channels = 1;
-                wave[mainToolbarState.soundSlotActive].data = GenerateWave(params[mainToolbarState.soundSlotActive], &wave[mainToolbarState.soundSlotActive].frameCount);
-
-                sound[mainToolbarState.soundSlotActive] = LoadSoundFromWave(wave[mainToolbarState.soundSlotActive]);    // Reload sound from new wave
+                CancelWavePrefetch(&prefetch, &worker);
+                unsigned int requestId = RequestWaveWorker(&worker, soundList.entries[mainToolbarState.soundSlotActive].params, mainToolbarState.soundSlotActive, draft);
+                generating = true;
 
+                // Start progressive playback, generated frames are streamed as they are available
                 if ((regenerate || playOnChange) &&
                     !windowAboutState.windowActive &&
                     !windowHelpState.windowActive &&
                     !showIssueReportWindow)
                 {
-                    PlaySound(sound[mainToolbarState.soundSlotActive]);
+                    StopSound(sound);
+                    StopAudioStream(stream);
+
+                    streamId = requestId;
+                    streamPosition = 0;
+                    streamDrain = 0;
+                    streaming = true;
                 }
 
                 regenerate = false;
             }
         }
 
-        // Check slot change to play next one selected
-        if (mainToolbarState.soundSlotActive != mainToolbarState.prevSoundSlotActive)
+        // Live preview logic, parameters changes sent to audio thread while sliders are dragged
+        if (liveActive)
         {
-            PlaySound(sound[mainToolbarState.soundSlotActive]);
-            mainToolbarState.prevSoundSlotActive = mainToolbarState.soundSlotActive;
+            // NOTE: If queue is full, parameters are sent again next frame
+            if ((memcmp(&liveParams, &soundList.entries[mainToolbarState.soundSlotActive].params, sizeof(WaveParams)) != 0) &&
+                PushLiveVoiceParams(&liveVoice, soundList.entries[mainToolbarState.soundSlotActive].params)) liveParams = soundList.entries[mainToolbarState.soundSlotActive].params;
+
+            if (!IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+            {
+                StopLiveVoice(&liveVoice);
+                liveActive = false;
+                liveStopping = true;
+                liveStopFrames = 0;
+            }
+        }
+        else if (liveStopping)
+        {
+            // Wait for audio thread to stop before generating, final parameters wave replaces live sound
+            // NOTE: Audio callback could be not called anymore, waiting is limited
+            liveStopFrames++;
+
+            if (IsLiveVoiceStopped(&liveVoice) || (liveStopFrames > LIVE_VOICE_STOP_FRAMES))
+            {
+                StopAudioStream(liveStream);
+                liveStopping = false;
+                regenerate = true;      // Regenerate wave and play it with final parameters
+            }
+        }
+
+        // Swap generated wave and sound when ready
+        // NOTE: Generated wave is 32bit float, 1 channel by default
+        // NOTE: Sound playing is already started by progressive playback
+        Wave generatedWave = { 0 };
+        int generatedSlot = 0;
+        bool generatedDraft = false;
+
+        if (GetWaveWorkerResult(&worker, &generatedWave, &generatedSlot, &generatedDraft))
+        {
+            if (generatedSlot == WAVE_PREFETCH_SLOT) StoreWavePrefetch(&prefetch, generatedWave);
+            else
+            {
+                // NOTE: Entry peaks reloaded from new wave, entry used on this frame (not evicted)
+                SetSoundEntryWave(&soundList, generatedSlot, generatedWave, LoadWavePeaks(generatedWave), generatedDraft);
+                soundList.entries[generatedSlot].lastUsed = frameCounter;
+
+                if (generatedSlot == mainToolbarState.soundSlotActive)
+                {
+                    // Update sound from new wave, sound audio buffer is only reloaded if new wave does not fit
+                    UpdateSoundFromWave(&sound, generatedWave, &soundFrames, &soundFramesSize);
+                    waveRedraw = true;
+
+                    // Entry selected on sound list window while not rendered
+                    if (listPlay && (generatedSlot == listRendering))
+                    {
+                        PlaySound(sound);
+                        listPlay = false;
+                    }
+                }
+
+                // Only latest request is generated, no more results pending
+                if (generatedSlot == listRendering) listRendering = -1;
+                else generating = false;
+            }
+        }
+
+        // Render sound list window visible entries not rendered, one entry at a time (current entry first)
+        // NOTE: Not while current entry is generating or streaming, main controls are locked while window is shown
+        if (showSoundListWindow && !generating && !streaming && (listRendering < 0) && !liveActive && !liveStopping)
+        {
+            int index = -1;
+
+            if (!soundList.entries[mainToolbarState.soundSlotActive].empty &&
+                (soundList.entries[mainToolbarState.soundSlotActive].wave.data == NULL)) index = mainToolbarState.soundSlotActive;
+
+            for (int i = listFirst; (index < 0) && (i <= listLast); i++)
+            {
+                if (!soundList.entries[i].empty && (soundList.entries[i].wave.data == NULL)) index = i;
+            }
+
+            if (index >= 0)
+            {
+                CancelWavePrefetch(&prefetch, &worker);
+                RequestWaveWorker(&worker, soundList.entries[index].params, index, false);
+                listRendering = index;
+            }
+        }
+
+        // Evict least recently used rendered waves over memory budget, current entry and visible rows kept
+        EvictSoundList(&soundList, SOUND_LIST_MEMORY_BUDGET, frameCounter);
+
+        // Regenerate draft wave at full quality once interaction stopped, sound replaced silently when ready
+        // NOTE: Not while streaming or live preview, sound playing is not interrupted
+        if (soundList.entries[mainToolbarState.soundSlotActive].draft && !generating && !streaming && !liveActive && !liveStopping && !showExploreWindow && !showSoundListWindow &&
+            ((GetTime() - requestTime) > WAVE_DRAFT_IDLE_TIME))
+        {
+            CancelWavePrefetch(&prefetch, &worker);
+            RequestWaveWorker(&worker, soundList.entries[mainToolbarState.soundSlotActive].params, mainToolbarState.soundSlotActive, false);
+            generating = true;      // Draft flag cleared when full quality wave is swapped in
+        }
+
+        // Render generator buttons next results while idle, one entry at a time
+        // NOTE: Any wave generation request cancels in-flight entry, it is requested again later
+        if (!generating && !streaming && !liveActive && !liveStopping && !showExploreWindow && !showSoundListWindow &&
+            !soundList.entries[mainToolbarState.soundSlotActive].draft && ((GetTime() - requestTime) > WAVE_DRAFT_IDLE_TIME))
+        {
+            RequestWavePrefetch(&prefetch, &worker, soundList.entries[mainToolbarState.soundSlotActive].params);
         }
 
         // Screen and mouse scale logic (x2)
@@ -677,6 +1446,8 @@ int main(int argc, char *argv[])
             showIssueReportWindow ||
             showSupportMessage ||
             showExportWindow ||
+            showExploreWindow ||
+            showSoundListWindow ||
             showExitWindow ||
             showLoadFileDialog ||
             showSaveFileDialog ||
@@ -685,11 +1456,44 @@ int main(int argc, char *argv[])
 
         // Draw
         //----------------------------------------------------------------------------------
-        // Render wave data to texture
-        BeginTextureMode(waveTarget);
-            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
-            DrawWave(&wave[mainToolbarState.soundSlotActive], (Rectangle){ 0, 0, (float)waveTarget.texture.width, (float)waveTarget.texture.height }, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
-        EndTextureMode();
+        // Render wave data to texture, only required on wave or style change
+        if (waveRedraw ||
+            (waveTextColor != GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)) ||
+            (waveBackColor != GuiGetStyle(DEFAULT, BACKGROUND_COLOR)))
+        {
+            waveTextColor = GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED);
+            waveBackColor = GuiGetStyle(DEFAULT, BACKGROUND_COLOR);
+
+            BeginTextureMode(waveTarget);
+                ClearBackground(GetColor(waveBackColor));
+                DrawWavePeaks(&soundList.entries[mainToolbarState.soundSlotActive].peaks, &soundList.entries[mainToolbarState.soundSlotActive].wave, 0, soundList.entries[mainToolbarState.soundSlotActive].wave.frameCount,
+                    (Rectangle){ 0, 0, (float)waveTarget.texture.width, (float)waveTarget.texture.height }, GetColor(waveTextColor));
+            EndTextureMode();
+
+            waveRedraw = false;
+            spectrogramRedraw = true;   // Style colors could be changed
+        }
+
+        // Update spectrogram texture from levels, background color for min level and wave color for 0 dB
+        if (spectrogramRedraw)
+        {
+            Color *pixels = (Color *)spectrogramImage.data;
+            Color backColor = GetColor(waveBackColor);
+            Color textColor = GetColor(waveTextColor);
+
+            for (int i = 0; i < spectrogramWorker.width*spectrogramWorker.height; i++)
+            {
+                int level = (spectrogramLevels != NULL)? spectrogramLevels[i] : 0;
+
+                pixels[i].r = (unsigned char)(backColor.r + (textColor.r - backColor.r)*level/255);
+                pixels[i].g = (unsigned char)(backColor.g + (textColor.g - backColor.g)*level/255);
+                pixels[i].b = (unsigned char)(backColor.b + (textColor.b - backColor.b)*level/255);
+                pixels[i].a = 255;
+            }
+
+            UpdateTexture(spectrogramTexture, pixels);
+            spectrogramRedraw = false;
+        }
 
         // Render all screen to texture (for scaling)
         BeginTextureMode(screenTarget);
@@ -701,15 +1505,20 @@ int main(int argc, char *argv[])
             int prevTextPadding = GuiGetStyle(BUTTON, TEXT_PADDING);
             GuiSetStyle(BUTTON, TEXT_PADDING, 3);
             GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            if (GuiButton((Rectangle){ 12, 48, 108, 24 }, "#131#Play Sound")) PlaySound(sound[mainToolbarState.soundSlotActive]);
-
-            if (GuiButton((Rectangle){ 12, 88, 108, 24 }, "#146#Pickup/Coin")) { params[mainToolbarState.soundSlotActive] = GenPickupCoin(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 116, 108, 24 }, "#145#Laser/Shoot")) { params[mainToolbarState.soundSlotActive] = GenLaserShoot(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 144, 108, 24 }, "#147#Explosion")) { params[mainToolbarState.soundSlotActive] = GenExplosion(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 172, 108, 24 }, "#148#PowerUp")) { params[mainToolbarState.soundSlotActive] = GenPowerup(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 200, 108, 24 }, "#152#Hit/Hurt")) { params[mainToolbarState.soundSlotActive] = GenHitHurt(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 228, 108, 24 }, "#150#Jump")) { params[mainToolbarState.soundSlotActive] = GenJump(); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 256, 108, 24 }, "#144#Blip/Select")) { params[mainToolbarState.soundSlotActive] = GenBlipSelect(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 48, 108, 24 }, "#131#Play Sound"))
+            {
+                StopAudioStream(stream);
+                streaming = false;
+                PlaySound(sound);
+            }
+
+            if (GuiButton((Rectangle){ 12, 88, 108, 24 }, "#146#Pickup/Coin")) sourcePressed = 0;
+            if (GuiButton((Rectangle){ 12, 116, 108, 24 }, "#145#Laser/Shoot")) sourcePressed = 1;
+            if (GuiButton((Rectangle){ 12, 144, 108, 24 }, "#147#Explosion")) sourcePressed = 2;
+            if (GuiButton((Rectangle){ 12, 172, 108, 24 }, "#148#PowerUp")) sourcePressed = 3;
+            if (GuiButton((Rectangle){ 12, 200, 108, 24 }, "#152#Hit/Hurt")) sourcePressed = 4;
+            if (GuiButton((Rectangle){ 12, 228, 108, 24 }, "#150#Jump")) sourcePressed = 5;
+            if (GuiButton((Rectangle){ 12, 256, 108, 24 }, "#144#Blip/Select")) sourcePressed = 6;
             GuiSetStyle(BUTTON, TEXT_PADDING, prevTextPadding);
             GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
 
@@ -717,19 +1526,22 @@ int main(int argc, char *argv[])
 
             GuiSetStyle(TOGGLE, TEXT_PADDING, 3);
             GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            GuiToggleGroup((Rectangle){ 12, 248 + 32 + 16, 108, 24 }, "#126#Square\n#127#Sawtooth\n#125#Sinewave\n#124#Noise", &params[mainToolbarState.soundSlotActive].waveTypeValue);
+            GuiToggleGroup((Rectangle){ 12, 248 + 32 + 16, 108, 24 }, "#126#Square\n#127#Sawtooth\n#125#Sinewave\n#124#Noise", &soundList.entries[mainToolbarState.soundSlotActive].params.waveTypeValue);
             GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
             GuiSetStyle(TOGGLE, TEXT_PADDING, 0);
 
             GuiLine((Rectangle){ 12, 248 + 32 + 16 + 4*24 + 3*2, 108, 16 }, NULL);
 
-            if (GuiButton((Rectangle){ 12, 414, 108, 24 }, "#75#Mutate")) { WaveMutate(&params[mainToolbarState.soundSlotActive]); regenerate = true; }
-            if (GuiButton((Rectangle){ 12, 414 + 24 + 4, 108, 24 }, "#77#Randomize")) { params[mainToolbarState.soundSlotActive] = GenRandomize(); regenerate = true; }
+            if (GuiButton((Rectangle){ 12, 414, 108, 24 }, "#75#Mutate")) sourcePressed = 8;
+            if (GuiButton((Rectangle){ 12, 414 + 24 + 4, 108, 24 }, "#77#Randomize")) sourcePressed = 7;
 
             // Parameters sliders
             //--------------------------------------------------------------------------------
             Vector2 paramsPos = { 260, 56 };
 
+            // NOTE: Entries can be moved when list grows, pointer only kept for sliders drawing
+            WaveParams *currentParams = &soundList.entries[mainToolbarState.soundSlotActive].params;
+
             GuiGroupBox((Rectangle){ paramsPos.x - 130, paramsPos.y - 8, 498, 24 }, NULL);
             GuiGroupBox((Rectangle){ paramsPos.x - 130, paramsPos.y + 24, 498, 16*4 + 8 }, NULL);
             GuiGroupBox((Rectangle){ paramsPos.x - 130, paramsPos.y + 95, 498, 16*2 + 8 + 1 }, NULL);
@@ -740,33 +1552,33 @@ int main(int argc, char *argv[])
 
             GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y - 2, 320, 12 }, "VOLUME", TextFormat("%i", (int)(volumeValue*100)), &volumeValue, 0, 1);
 
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 30, 320, 12 }, "ATTACK TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].attackTimeValue), &params[mainToolbarState.soundSlotActive].attackTimeValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SUSTAIN TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].sustainTimeValue), &params[mainToolbarState.soundSlotActive].sustainTimeValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SUSTAIN PUNCH", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].sustainPunchValue), &params[mainToolbarState.soundSlotActive].sustainPunchValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DECAY TIME", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].decayTimeValue), &params[mainToolbarState.soundSlotActive].decayTimeValue, 0, 1);
-
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "START FREQUENCY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].startFrequencyValue), &params[mainToolbarState.soundSlotActive].startFrequencyValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "MIN FREQUENCY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].minFrequencyValue), &params[mainToolbarState.soundSlotActive].minFrequencyValue, 0, 1);
-
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "SLIDE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].slideValue), &params[mainToolbarState.soundSlotActive].slideValue, -1, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DELTA SLIDE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].deltaSlideValue), &params[mainToolbarState.soundSlotActive].deltaSlideValue, -1, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "VIBRATO DEPTH", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].vibratoDepthValue), &params[mainToolbarState.soundSlotActive].vibratoDepthValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "VIBRATO SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].vibratoSpeedValue), &params[mainToolbarState.soundSlotActive].vibratoSpeedValue, 0, 1);
-
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "CHANGE AMOUNT", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].changeAmountValue), &params[mainToolbarState.soundSlotActive].changeAmountValue, -1, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "CHANGE SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].changeSpeedValue), &params[mainToolbarState.soundSlotActive].changeSpeedValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SQUARE DUTY", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].squareDutyValue), &params[mainToolbarState.soundSlotActive].squareDutyValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DUTY SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].dutySweepValue), &params[mainToolbarState.soundSlotActive].dutySweepValue, -1, 1);
-
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "REPEAT SPEED", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].repeatSpeedValue), &params[mainToolbarState.soundSlotActive].repeatSpeedValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "PHASER OFFSET", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].phaserOffsetValue), &params[mainToolbarState.soundSlotActive].phaserOffsetValue, -1, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "PHASER SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].phaserSweepValue), &params[mainToolbarState.soundSlotActive].phaserSweepValue, -1, 1);
-
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "LPF CUTOFF", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfCutoffValue), &params[mainToolbarState.soundSlotActive].lpfCutoffValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "LPF CUTOFF SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfCutoffSweepValue), &params[mainToolbarState.soundSlotActive].lpfCutoffSweepValue, -1, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "LPF RESONANCE", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].lpfResonanceValue), &params[mainToolbarState.soundSlotActive].lpfResonanceValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "HPF CUTOFF", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].hpfCutoffValue), &params[mainToolbarState.soundSlotActive].hpfCutoffValue, 0, 1);
-            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "HPF CUTOFF SWEEP", TextFormat("%.2f", params[mainToolbarState.soundSlotActive].hpfCutoffSweepValue), &params[mainToolbarState.soundSlotActive].hpfCutoffSweepValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 30, 320, 12 }, "ATTACK TIME", TextFormat("%.2f", currentParams->attackTimeValue), &currentParams->attackTimeValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SUSTAIN TIME", TextFormat("%.2f", currentParams->sustainTimeValue), &currentParams->sustainTimeValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SUSTAIN PUNCH", TextFormat("%.2f", currentParams->sustainPunchValue), &currentParams->sustainPunchValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DECAY TIME", TextFormat("%.2f", currentParams->decayTimeValue), &currentParams->decayTimeValue, 0, 1);
+
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "START FREQUENCY", TextFormat("%.2f", currentParams->startFrequencyValue), &currentParams->startFrequencyValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "MIN FREQUENCY", TextFormat("%.2f", currentParams->minFrequencyValue), &currentParams->minFrequencyValue, 0, 1);
+
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "SLIDE", TextFormat("%.2f", currentParams->slideValue), &currentParams->slideValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DELTA SLIDE", TextFormat("%.2f", currentParams->deltaSlideValue), &currentParams->deltaSlideValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "VIBRATO DEPTH", TextFormat("%.2f", currentParams->vibratoDepthValue), &currentParams->vibratoDepthValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "VIBRATO SPEED", TextFormat("%.2f", currentParams->vibratoSpeedValue), &currentParams->vibratoSpeedValue, 0, 1);
+
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "CHANGE AMOUNT", TextFormat("%.2f", currentParams->changeAmountValue), &currentParams->changeAmountValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "CHANGE SPEED", TextFormat("%.2f", currentParams->changeSpeedValue), &currentParams->changeSpeedValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "SQUARE DUTY", TextFormat("%.2f", currentParams->squareDutyValue), &currentParams->squareDutyValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "DUTY SWEEP", TextFormat("%.2f", currentParams->dutySweepValue), &currentParams->dutySweepValue, -1, 1);
+
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "REPEAT SPEED", TextFormat("%.2f", currentParams->repeatSpeedValue), &currentParams->repeatSpeedValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "PHASER OFFSET", TextFormat("%.2f", currentParams->phaserOffsetValue), &currentParams->phaserOffsetValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "PHASER SWEEP", TextFormat("%.2f", currentParams->phaserSweepValue), &currentParams->phaserSweepValue, -1, 1);
+
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 24, 320, 12 }, "LPF CUTOFF", TextFormat("%.2f", currentParams->lpfCutoffValue), &currentParams->lpfCutoffValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "LPF CUTOFF SWEEP", TextFormat("%.2f", currentParams->lpfCutoffSweepValue), &currentParams->lpfCutoffSweepValue, -1, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "LPF RESONANCE", TextFormat("%.2f", currentParams->lpfResonanceValue), &currentParams->lpfResonanceValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "HPF CUTOFF", TextFormat("%.2f", currentParams->hpfCutoffValue), &currentParams->hpfCutoffValue, 0, 1);
+            GuiSliderBar((Rectangle){ paramsPos.x, paramsPos.y += 16, 320, 12 }, "HPF CUTOFF SWEEP", TextFormat("%.2f", currentParams->hpfCutoffSweepValue), &currentParams->hpfCutoffSweepValue, -1, 1);
             //--------------------------------------------------------------------------------
 
             // Draw Wave form
@@ -774,10 +1586,14 @@ int main(int argc, char *argv[])
             DrawTextureEx(waveTarget.texture, (Vector2){ waveRec.x, waveRec.y }, 0.0f, 0.5f, WHITE);
             DrawRectangle((int)waveRec.x, (int)waveRec.y + (int)waveRec.height/2, (int)waveRec.width, 1, Fade(GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_FOCUSED)), 0.6f));
             DrawRectangleLinesEx(waveRec, 1.0f, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+
+            DrawTextureEx(spectrogramTexture, (Vector2){ spectrogramRec.x, spectrogramRec.y }, 0.0f, 0.5f, WHITE);
+            DrawRectangleLinesEx(spectrogramRec, 1.0f, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
             //--------------------------------------------------------------------------------
 
             // GUI: Main toolbar panel
             //----------------------------------------------------------------------------------
+            mainToolbarState.soundSlotCount = soundList.count;
             GuiMainToolbar(&mainToolbarState);
             //----------------------------------------------------------------------------------
 
@@ -786,9 +1602,9 @@ int main(int argc, char *argv[])
             int textPadding = GuiGetStyle(STATUSBAR, TEXT_PADDING);
             GuiSetStyle(STATUSBAR, TEXT_PADDING, 0);
             GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-            GuiStatusBar((Rectangle){ 0, screenHeight - 24, 190, 24 }, TextFormat("Total Frames: %i", wave[mainToolbarState.soundSlotActive].frameCount));
-            GuiStatusBar((Rectangle){ 190 - 1, screenHeight - 24, 170, 24 }, TextFormat("Duration: %i ms", wave[mainToolbarState.soundSlotActive].frameCount*1000/(wave[mainToolbarState.soundSlotActive].sampleRate)));
-            GuiStatusBar((Rectangle){ 190 + 170 - 2, screenHeight - 24, screenWidth - (190 + 170 - 2), 24 }, TextFormat("Size: %i bytes", wave[mainToolbarState.soundSlotActive].frameCount *wave[mainToolbarState.soundSlotActive].channels *exportSampleSize/8));
+            GuiStatusBar((Rectangle){ 0, screenHeight - 24, 190, 24 }, TextFormat("Total Frames: %i", soundList.entries[mainToolbarState.soundSlotActive].wave.frameCount));
+            GuiStatusBar((Rectangle){ 190 - 1, screenHeight - 24, 170, 24 }, TextFormat("Duration: %i ms", soundList.entries[mainToolbarState.soundSlotActive].wave.frameCount*1000/(soundList.entries[mainToolbarState.soundSlotActive].wave.sampleRate)));
+            GuiStatusBar((Rectangle){ 190 + 170 - 2, screenHeight - 24, screenWidth - (190 + 170 - 2), 24 }, TextFormat("Size: %i bytes", soundList.entries[mainToolbarState.soundSlotActive].wave.frameCount *soundList.entries[mainToolbarState.soundSlotActive].wave.channels *exportSampleSize/8));
             GuiSetStyle(STATUSBAR, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
             GuiSetStyle(STATUSBAR, TEXT_PADDING, textPadding);
             //----------------------------------------------------------------------------------
@@ -844,12 +1660,14 @@ int main(int argc, char *argv[])
                 GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12 + 48 + 16, 106, 24 }, "Sample Size:");
                 GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12 + 72 + 24, 106, 24 }, "Channels:");
 
-                GuiComboBox((Rectangle){ messageBox.x + 12 + 100, messageBox.y + 24 + 12, 124, 24 }, "WAV;QOA;RAW;CODE", &fileTypeActive);
+                GuiComboBox((Rectangle){ messageBox.x + 12 + 100, messageBox.y + 24 + 12, 124, 24 }, "WAV;QOA;RAW;CODE;ADPCM;EMBED;PARAMS", &fileTypeActive);
+                if (fileTypeActive == 6) GuiDisable();  // Parameters code: wave format defined by generator
                 GuiComboBox((Rectangle){ messageBox.x + 12 + 100, messageBox.y + 24 + 12 + 24 + 8, 124, 24 }, "22050 Hz;44100 Hz", &sampleRateActive);
-                if (fileTypeActive == 1) { sampleSizeActive = 1; GuiDisable(); }
+                if ((fileTypeActive == 1) || (fileTypeActive == 4)) { sampleSizeActive = 1; GuiDisable(); }
                 GuiComboBox((Rectangle){ messageBox.x + 12 + 100, messageBox.y + 24 + 12 + 48 + 16, 124, 24 }, "8 bit;16 bit;32 bit", &sampleSizeActive);
-                GuiEnable();
+                if (fileTypeActive != 6) GuiEnable();
                 GuiComboBox((Rectangle){ messageBox.x + 12 + 100, messageBox.y + 24 + 12 + 72 + 24, 124, 24 }, "Mono;Stereo", &channelsActive);
+                GuiEnable();
 
                 if (btnActive == 1)    // Export button pressed
                 {
@@ -861,6 +1679,8 @@ int main(int argc, char *argv[])
                     else if (sampleSizeActive == 1) exportSampleSize = 16;
                     else if (sampleSizeActive == 2) exportSampleSize = 32;
 
+                    if (fileTypeActive == 4) exportSampleSize = 4;  // IMA-ADPCM: 4 bit per sample
+
                     exportChannels = channelsActive + 1;
 
                     showExportWindow = false;
@@ -873,32 +1693,125 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------
 
-            // GUI: Exit Window
+            // GUI: Explore Window
             //----------------------------------------------------------------------------------------
-            if (showExitWindow)
+            if (showExploreWindow)
             {
-                int btnActive = -1;
-                GuiMessageBox((Rectangle){ (float)screenWidth/2 - 125, (float)screenHeight/2 - 50, 250, 100 },
-                    "#159#Closing rFXGen", "Do you really want to exit?", "#112#Yes;#113#No", &btnActive);
+                Rectangle exploreBounds = { 8, 36, 624, 516 };
+                int prevExploreSourceActive = exploreSourceActive;
+                int prevExploreCountActive = exploreCountActive;
 
-                if ((btnActive == 0) || (btnActive == 2)) showExitWindow = false;
-                else if (btnActive == 1) closeWindow = true;
+                if (GuiWindowBox(exploreBounds, "#75#Explore Sounds")) showExploreWindow = false;
+
+                GuiToggleGroup((Rectangle){ exploreBounds.x + 8, exploreBounds.y + 24 + 8, 65, 24 }, "Coin;Laser;Explosion;PowerUp;Hit;Jump;Blip;Random;Mutate", &exploreSourceActive);
+                GuiLabel((Rectangle){ exploreBounds.x + 8, exploreBounds.y + 24 + 8 + 32, 80, 24 }, "Candidates:");
+                GuiToggleGroup((Rectangle){ exploreBounds.x + 8 + 80, exploreBounds.y + 24 + 8 + 32, 40, 24 }, "16;32;64", &exploreCountActive);
+                GuiLabel((Rectangle){ exploreBounds.x + 8 + 80 + 136, exploreBounds.y + 24 + 8 + 32, 260, 24 }, "Hover/arrows to play, click/ENTER to pick");
+                if (GuiButton((Rectangle){ exploreBounds.x + exploreBounds.width - 8 - 120, exploreBounds.y + 24 + 8 + 32, 120, 24 }, "#77#Generate")) exploreRequest = true;
+
+                if ((exploreSourceActive != prevExploreSourceActive) || (exploreCountActive != prevExploreCountActive)) exploreRequest = true;
+
+                for (int i = 0; i < exploreGrid.count; i++)
+                {
+                    Rectangle bounds = GetExploreCandidateBounds(exploreGridRec, exploreGrid.count, i);
+
+                    if (i == exploreCursor) DrawRectangleRec(bounds, GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_FOCUSED)));
+                    if (exploreGrid.candidates[i].peaks.levelCount > 0)
+                    {
+                        DrawWavePeaks(&exploreGrid.candidates[i].peaks, &exploreGrid.candidates[i].wave, 0, exploreGrid.candidates[i].wave.frameCount,
+                            (Rectangle){ bounds.x + 1, bounds.y + 1, bounds.width - 2, bounds.height - 2 }, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
+                    }
+                    DrawRectangleLinesEx(bounds, 1.0f, GetColor(GuiGetStyle(DEFAULT, (i == exploreCursor)? BORDER_COLOR_FOCUSED : LINE_COLOR)));
+                }
             }
-            //----------------------------------------------------------------------------------------
+            //----------------------------------------------------------------------------------
 
-            // GUI: Load File Dialog (and loading logic)
+            // GUI: Sound List Window
             //----------------------------------------------------------------------------------------
-            if (showLoadFileDialog)
+            if (showSoundListWindow)
             {
-#if defined(CUSTOM_MODAL_DIALOGS)
-                int result = GuiFileDialog(DIALOG_MESSAGE, "Load sound file ...", inFileName, "Ok", "Just drag and drop your .rfx sound file!");
-#else
-                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load sound parameters file...", inFileName, "*.rfx", "Sound Param Files (*.rfx)");
-#endif
-                if (result == 1)
+                Rectangle listBounds = { 8, 36, 624, 516 };
+                Rectangle listPanelRec = { listBounds.x + 8, listBounds.y + 24 + 8 + 32, listBounds.width - 16, listBounds.height - 24 - 8 - 32 - 8 };
+                const char *waveTypeNames[4] = { "Square", "Sawtooth", "Sinewave", "Noise" };
+
+                if (GuiWindowBox(listBounds, "#197#Sounds List")) showSoundListWindow = false;
+
+                if (GuiButton((Rectangle){ listBounds.x + 8, listBounds.y + 24 + 8, 120, 24 }, "#8#Add Sound"))
                 {
-                    // Load parameters file
-                    params[mainToolbarState.soundSlotActive] = LoadWaveParams(inFileName);
+                    int index = AddSoundEntry(&soundList, defaultParams, NULL, true);
+                    if (index >= 0) mainToolbarState.soundSlotActive = index;
+                }
+
+                if (soundList.count <= 1) GuiDisable();
+                if (GuiButton((Rectangle){ listBounds.x + 8 + 124, listBounds.y + 24 + 8, 120, 24 }, "#143#Remove Sound")) listRemoveRequest = true;
+                GuiEnable();
+
+                GuiLabel((Rectangle){ listBounds.x + 8 + 256, listBounds.y + 24 + 8, 344, 24 }, TextFormat("Sounds: %i | Rendered: %.1f MB (max %i MB)",
+                    soundList.count, (float)soundList.memoryUsed/(1024*1024), SOUND_LIST_MEMORY_BUDGET/(1024*1024)));
+
+                // Only visible rows are drawn, visible range also used by entries rendering and eviction
+                GuiScrollPanel(listPanelRec, NULL, (Rectangle){ 0, 0, listPanelRec.width - 16, (float)soundList.count*SOUND_LIST_ROW_HEIGHT }, &listScroll, &listView);
+
+                listFirst = (int)(-listScroll.y/SOUND_LIST_ROW_HEIGHT);
+                listLast = (int)((-listScroll.y + listView.height)/SOUND_LIST_ROW_HEIGHT);
+                if (listFirst < 0) listFirst = 0;
+                if (listLast > (soundList.count - 1)) listLast = soundList.count - 1;
+
+                BeginScissorMode((int)listView.x, (int)listView.y, (int)listView.width, (int)listView.height);
+
+                    for (int i = listFirst; i <= listLast; i++)
+                    {
+                        SoundEntry *entry = &soundList.entries[i];
+                        Rectangle rowRec = { listView.x, listView.y + listScroll.y + i*SOUND_LIST_ROW_HEIGHT, listView.width, SOUND_LIST_ROW_HEIGHT };
+                        Rectangle waveBounds = { rowRec.x + rowRec.width - 8 - 240, rowRec.y + 4, 240, SOUND_LIST_ROW_HEIGHT - 8 };
+
+                        if (i == mainToolbarState.soundSlotActive) DrawRectangleRec(rowRec, GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_FOCUSED)));
+
+                        GuiLabel((Rectangle){ rowRec.x + 8, rowRec.y + 4, 40, 24 }, TextFormat("%03i", i + 1));
+                        GuiLabel((Rectangle){ rowRec.x + 48, rowRec.y + 4, 160, 24 }, (entry->name[0] != '\0')? entry->name : "Untitled");
+                        GuiLabel((Rectangle){ rowRec.x + 212, rowRec.y + 4, 72, 24 }, ((entry->params.waveTypeValue >= 0) && (entry->params.waveTypeValue < 4))? waveTypeNames[entry->params.waveTypeValue] : NULL);
+
+                        if (entry->wave.data != NULL)
+                        {
+                            GuiLabel((Rectangle){ rowRec.x + 288, rowRec.y + 4, 64, 24 }, TextFormat("%i ms", entry->wave.frameCount*1000/entry->wave.sampleRate));
+                            DrawWavePeaks(&entry->peaks, &entry->wave, 0, entry->wave.frameCount, waveBounds, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED)));
+                        }
+                        else GuiLabel((Rectangle){ waveBounds.x + 8, waveBounds.y, waveBounds.width - 16, waveBounds.height }, entry->empty? "Empty" : "Rendering...");
+
+                        DrawRectangleLinesEx(waveBounds, 1.0f, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+                    }
+
+                EndScissorMode();
+            }
+            //----------------------------------------------------------------------------------
+
+            // GUI: Exit Window
+            //----------------------------------------------------------------------------------------
+            if (showExitWindow)
+            {
+                int btnActive = -1;
+                GuiMessageBox((Rectangle){ (float)screenWidth/2 - 125, (float)screenHeight/2 - 50, 250, 100 },
+                    "#159#Closing rFXGen", "Do you really want to exit?", "#112#Yes;#113#No", &btnActive);
+
+                if ((btnActive == 0) || (btnActive == 2)) showExitWindow = false;
+                else if (btnActive == 1) closeWindow = true;
+            }
+            //----------------------------------------------------------------------------------------
+
+            // GUI: Load File Dialog (and loading logic)
+            //----------------------------------------------------------------------------------------
+            if (showLoadFileDialog)
+            {
+#if defined(CUSTOM_MODAL_DIALOGS)
+                int result = GuiFileDialog(DIALOG_MESSAGE, "Load sound file ...", inFileName, "Ok", "Just drag and drop your .rfx sound file!");
+#else
+                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load sound parameters file...", inFileName, "*.rfx", "Sound Param Files (*.rfx)");
+#endif
+                if (result == 1)
+                {
+                    // Load parameters file
+                    soundList.entries[mainToolbarState.soundSlotActive].params = LoadWaveParams(inFileName);
+                    strncpy(soundList.entries[mainToolbarState.soundSlotActive].name, GetFileNameWithoutExt(inFileName), sizeof(soundList.entries[0].name) - 1);
                     SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
                     regenerate = true;
                 }
@@ -923,7 +1836,8 @@ int main(int argc, char *argv[])
                     // Save file: outFileName
                     // Check for valid extension and make sure it is
                     if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rfx")) strcat(outFileName, ".rfx\0");
-                    SaveWaveParams(params[mainToolbarState.soundSlotActive], outFileName);    // Save wave parameters
+                    SaveWaveParams(soundList.entries[mainToolbarState.soundSlotActive].params, outFileName);    // Save wave parameters
+                    strncpy(soundList.entries[mainToolbarState.soundSlotActive].name, GetFileNameWithoutExt(outFileName), sizeof(soundList.entries[0].name) - 1);
 
                 #if defined(PLATFORM_WEB)
                     // Download file from MEMFS (emscripten memory filesystem)
@@ -954,16 +1868,41 @@ int main(int argc, char *argv[])
                 else if (fileTypeActive == 1) { strcpy(fileTypeFilters, "*.qoa"); strcat(outFileName, ".qoa"); }
                 else if (fileTypeActive == 2) { strcpy(fileTypeFilters, "*.raw"); strcat(outFileName, ".raw"); }
                 else if (fileTypeActive == 3) { strcpy(fileTypeFilters, "*.h"); strcat(outFileName, ".h"); }
+                else if (fileTypeActive == 4) { strcpy(fileTypeFilters, "*.wav"); strcat(outFileName, ".wav"); }
+                else if (fileTypeActive == 5) { strcpy(fileTypeFilters, "*.bin"); strcat(outFileName, ".bin"); }
+                else if (fileTypeActive == 6) { strcpy(fileTypeFilters, "*.h"); strcat(outFileName, ".h"); }
 
                 result = GuiFileDialog(DIALOG_SAVE_FILE, "Export wave file...", outFileName, fileTypeFilters, TextFormat("File type (%s)", fileTypeFilters));
 #endif
                 if (result == 1)
                 {
                     // Export file: outFileName
-                    Wave cwave = WaveCopy(wave[mainToolbarState.soundSlotActive]);
-                    WaveFormat(&cwave, exportSampleRate, exportSampleSize, exportChannels);   // Before exporting wave data, format it as desired
+                    // NOTE: Draft waves (lower quality, truncated) and not rendered entries are generated at full quality
+                    SoundEntry *entry = &soundList.entries[mainToolbarState.soundSlotActive];
+                    Wave cwave = { 0 };
+
+                    if (fileTypeActive != 6)
+                    {
+                        if (entry->draft || (entry->wave.data == NULL))
+                        {
+                            cwave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+                            cwave.sampleSize = 32;
+                            cwave.channels = 1;
+                            cwave.data = GenerateWave(entry->params, &cwave.frameCount);
+                        }
+                        else cwave = WaveCopy(entry->wave);
+
+                        if (cwave.data != NULL) WaveFormat(&cwave, exportSampleRate, (exportSampleSize == 4)? 16 : exportSampleSize, exportChannels);   // Before exporting wave data, format it as desired
+                    }
 
-                    if (fileTypeActive == 0)
+                    if (fileTypeActive == 6)   // Export as parameters code file (synthesized at runtime)
+                    {
+                        // Check for valid extension and make sure it is
+                        if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".h")) strcat(outFileName, ".h\0");
+                        ExportWaveParamsCode(entry->params, outFileName);
+                    }
+                    else if (cwave.data == NULL) LOG("WARNING: Wave could not be generated for export\n");
+                    else if (fileTypeActive == 0)
                     {
                         // Check for valid extension and make sure it is
                         if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".wav")) strcat(outFileName, ".wav\0");
@@ -993,6 +1932,18 @@ int main(int argc, char *argv[])
                         if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".h")) strcat(outFileName, ".h\0");
                         ExportWaveAsCode(cwave, outFileName); // Export wave data as code file
                     }
+                    else if (fileTypeActive == 4)   // Export Wave as IMA-ADPCM WAV
+                    {
+                        // Check for valid extension and make sure it is
+                        if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".wav")) strcat(outFileName, ".wav\0");
+                        ExportWaveBufferADPCM((WaveBuffer){ cwave.frameCount, cwave.sampleRate, cwave.sampleSize, cwave.channels, cwave.data }, outFileName);
+                    }
+                    else if (fileTypeActive == 5)   // Export as binary data file and embedding header
+                    {
+                        // Check for valid extension and make sure it is
+                        if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".bin")) strcat(outFileName, ".bin\0");
+                        ExportWaveBuffer((WaveBuffer){ cwave.frameCount, cwave.sampleRate, cwave.sampleSize, cwave.channels, cwave.data }, outFileName);
+                    }
 
                     UnloadWave(cwave);
 
@@ -1001,6 +1952,13 @@ int main(int argc, char *argv[])
                     // NOTE: Second argument must be a simple filename (can't use directories)
                     // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
                     if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
+
+                    // Embedding header (.h) is saved next to binary data file (.bin)
+                    if ((fileTypeActive == 5) && (strchr(outFileName, '\'') == NULL))
+                    {
+                        const char *headerFileName = TextFormat("%s.h", GetFileNameWithoutExt(outFileName));
+                        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", headerFileName, headerFileName));
+                    }
                 #endif
                 }
 
@@ -1040,6 +1998,62 @@ int main(int argc, char *argv[])
 
         EndTextureMode();
 
+        // Progressive playback logic, stream sub-buffers updated with generated frames
+        // NOTE: Updated after drawing, giving time to worker to generate first frames
+        //----------------------------------------------------------------------------------
+        while (streaming && IsAudioStreamProcessed(stream))
+        {
+            if (streamDrain > 0)
+            {
+                // Wave ended, one sub-buffer of silence is played before stopping (avoids replaying old sub-buffer)
+                if (streamDrain == 2) { StopAudioStream(stream); streaming = false; break; }
+
+                memset(streamFrames, 0, WAVE_STREAM_BUFFER_FRAMES*sizeof(float));
+                UpdateAudioStream(stream, streamFrames, WAVE_STREAM_BUFFER_FRAMES);
+                streamDrain++;
+                break;
+            }
+
+            bool finished = false;
+            unsigned int count = GetWaveWorkerFrames(&worker, streamId, streamPosition, streamFrames, WAVE_STREAM_BUFFER_FRAMES, &finished);
+
+            if (!finished && (count < WAVE_STREAM_BUFFER_FRAMES)) break;   // Waiting for worker to generate a full sub-buffer
+
+            if (count < WAVE_STREAM_BUFFER_FRAMES) memset(streamFrames + count, 0, (WAVE_STREAM_BUFFER_FRAMES - count)*sizeof(float));
+            UpdateAudioStream(stream, streamFrames, WAVE_STREAM_BUFFER_FRAMES);
+            streamPosition += count;
+
+            if (finished) streamDrain = 1;
+            if (!IsAudioStreamPlaying(stream)) PlayAudioStream(stream);
+        }
+
+        // Request spectrogram on displayed wave change, texture updated when computed
+        // NOTE: Wave is copied by request, slot wave can be replaced meanwhile
+        if (waveRedraw)
+        {
+            RequestSpectrogramWorker(&spectrogramWorker, soundList.entries[mainToolbarState.soundSlotActive].wave);
+            spectrogramPending = true;
+        }
+
+        if (spectrogramPending && GetSpectrogramWorkerResult(&spectrogramWorker, &spectrogramLevels))
+        {
+            spectrogramPending = false;
+            spectrogramRedraw = true;
+        }
+
+        // Keep frames running while generating, streaming, live preview, draft waiting for regeneration,
+        // spectrogram computing, explore candidates rendering, sound list entries rendering or generator
+        // buttons results prefetching, no input events are received meanwhile
+        if (eventWaiting == (generating || streaming || liveActive || liveStopping || spectrogramPending ||
+            exploreRequest || exploreRendering || (listRendering >= 0) || soundList.entries[mainToolbarState.soundSlotActive].draft || prefetch.pending ||
+            (!showExploreWindow && !showSoundListWindow && !IsWavePrefetchFull(&prefetch, soundList.entries[mainToolbarState.soundSlotActive].params))))
+        {
+            eventWaiting = !eventWaiting;
+            if (eventWaiting) EnableEventWaiting();
+            else DisableEventWaiting();
+        }
+        //----------------------------------------------------------------------------------
+
         BeginDrawing();
             ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
 
@@ -1053,14 +2067,24 @@ int main(int argc, char *argv[])
 
     // De-Initialization
     //----------------------------------------------------------------------------------------
-    for (int i = 0; i < MAX_WAVE_SLOTS; i++)
-    {
-        UnloadSound(sound[i]);  // Unload sounds
-        UnloadWave(wave[i]);    // Unload wave slots (free done internally)
-    }
+    CloseWaveWorker(&worker);   // Close wave worker, pending wave is unloaded
+    UnloadWavePrefetch(&prefetch);                  // Unload generator buttons prefetched results
+    CloseSpectrogramWorker(&spectrogramWorker);     // Close spectrogram worker, pending request is unloaded
+    UnloadExploreGrid(&exploreGrid);                // Unload explore candidates, rendering cancelled
+    UnloadSound(exploreSound);
+    RL_FREE(spectrogramLevels);
+    RL_FREE(soundFrames);
+    UnloadAudioStream(stream);  // Unload progressive playback stream
+    UnloadAudioStream(liveStream);  // Unload live preview stream, audio callback not called anymore
+    UnloadWaveGenerator(liveVoice.generator);
+
+    UnloadSound(sound);         // Unload current entry sound
+    UnloadSoundList(&soundList);    // Unload sound list entries, rendered waves and peaks
 
     UnloadRenderTexture(screenTarget);
     UnloadRenderTexture(waveTarget);
+    UnloadTexture(spectrogramTexture);
+    UnloadImage(spectrogramImage);
 
     CloseAudioDevice();         // Close audio device
     CloseWindow();              // Close window and OpenGL context
@@ -1070,396 +2094,1353 @@ int main(int argc, char *argv[])
 }
 
 //--------------------------------------------------------------------------------------------
-// Module Functions Definition
+// Auxiliar functions
 //--------------------------------------------------------------------------------------------
-#if defined(PLATFORM_DESKTOP)
-// Show command line usage info
-static void ShowCommandLineInfo(void)
+// Load wave peaks pyramid from wave data (32bit float, mono)
+// NOTE: Peaks are computed once per wave, drawing cost does not depend on wave length
+static WavePeaks LoadWavePeaks(Wave wave)
 {
-    printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
-    printf("//                                                                              //\n");
-    printf("// %s v%s - %s                   //\n", toolName, toolVersion, toolDescription);
-    printf("// powered by raylib v%s and raygui v%s                               //\n", RAYLIB_VERSION, RAYGUI_VERSION);
-    printf("// more info and bugs-report: github.com/raysan5/rfxgen                         //\n");
-    printf("//                                                                              //\n");
-    printf("// Copyright (c) 2014-2026 raylib technologies (@raylibtech)                    //\n");
-    printf("//                                                                              //\n");
-    printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
-
-    printf("USAGE:\n\n");
-    printf("    > rfxgen [--help] --input <filename.ext> [--output <filename.ext>]\n");
-    printf("             [--format <sample_rate>,<sample_size>,<channels>] [--play <filename.ext>]\n");
-
-    printf("\nOPTIONS:\n\n");
-    printf("    -h, --help                      : Show tool version and command line usage help\n\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
-    printf("                                      Supported extensions: .rfx, .wav, .qoa, .ogg, .flac, .mp3\n\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
-    printf("                                      Supported extensions: .wav, .qoa, .raw, .h\n");
-    printf("                                      NOTE: If not specified, defaults to: output.wav\n\n");
-    printf("    -g, --generate <preset>            : Generate file based on the preset.\n");
-    printf("                                      Supported presets: coin, laser, explosion, powerup, hit, jump, blip\n");
-    printf("    -f, --format <sample_rate>,<sample_size>,<channels>\n");
-    printf("                                    : Define output wave format. Comma separated values.\n");
-    printf("                                      Supported values:\n");
-    printf("                                          Sample rate:      22050, 44100\n");
-    printf("                                          Sample size:      8, 16, 32\n");
-    printf("                                          Channels:         1 (mono), 2 (stereo)\n");
-    printf("                                      NOTE: If not specified, defaults to: 44100, 16, 1\n\n");
-    printf("    -p, --play <filename.ext>       : Play provided sound.\n");
-    printf("                                      Supported extensions: .wav, .qoa, .ogg, .flac, .mp3\n");
-
-    printf("\nEXAMPLES:\n\n");
-    printf("    > rfxgen --input sound.rfx --output jump.wav\n");
-    printf("        Process <sound.rfx> to generate <sound.wav> at 44100 Hz, 32 bit, Mono\n\n");
-    printf("    > rfxgen --input sound.rfx --output jump.raw --format 22050,16,2\n");
-    printf("        Process <sound.rfx> to generate <jump.raw> at 22050 Hz, 16 bit, Stereo\n\n");
-    printf("    > rfxgen --input sound.ogg --play output.wav\n");
-    printf("        Process <sound.ogg> to generate <output.wav> and play <output.wav>\n\n");
-    printf("    > rfxgen --input sound.mp3 --output jump.wav --format 22050,8,1 --play jump.wav\n");
-    printf("        Process <sound.mp3> to generate <jump.wav> at 22050 Hz, 8 bit, Stereo.\n");
-    printf("        Plays generated sound <jump.wav>.\n");
-}
+    WavePeaks peaks = { 0 };
 
-// Process command line input
-static void ProcessCommandLine(int argc, char *argv[])
-{
-    // CLI required variables
-    bool showUsageInfo = false;         // Toggle command line usage info
-    char playFileName[512] = { 0 };     // Play file name
-    char presetType[32] = { 0 };        // Type of the preset to be generated
+    if ((wave.data == NULL) || (wave.frameCount == 0)) return peaks;
 
-    int sampleRate = 44100;             // Default conversion sample rate
-    int sampleSize = 16;                // Default conversion sample size
-    int channels = 1;                   // Default conversion channels number
+    peaks.frameCount = wave.frameCount;
 
-    if (argc == 1) showUsageInfo = true;
+    // Get peaks count per level, up to one peak for full wave
+    unsigned int totalCount = 0;
+    unsigned int count = (wave.frameCount + WAVE_PEAKS_BLOCK_FRAMES - 1)/WAVE_PEAKS_BLOCK_FRAMES;
 
-    // Process command line arguments
-    for (int i = 1; i < argc; i++)
+    while (peaks.levelCount < WAVE_PEAKS_MAX_LEVELS)
     {
-        if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
-        {
-            showUsageInfo = true;
-        }
-        else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
-        {
-            // Check for valid argument and valid file extension
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
-            {
-                if (IsFileExtension(argv[i + 1], ".rfx") ||
-                    IsFileExtension(argv[i + 1], ".wav") ||
-                    IsFileExtension(argv[i + 1], ".qoa") ||
-                    IsFileExtension(argv[i + 1], ".ogg") ||
-                    IsFileExtension(argv[i + 1], ".flac") ||
-                    IsFileExtension(argv[i + 1], ".mp3"))
-                {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
-                }
-                else LOG("WARNING: Input file extension not recognized\n");
+        peaks.count[peaks.levelCount] = count;
+        peaks.levelCount++;
+        totalCount += count;
 
-                i++;
-            }
-            else LOG("WARNING: No input file provided\n");
-        }
-        else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
-        {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
-            {
-                if (IsFileExtension(argv[i + 1], ".wav") ||
-                    IsFileExtension(argv[i + 1], ".qoa") ||
-                    IsFileExtension(argv[i + 1], ".raw") ||
-                    IsFileExtension(argv[i + 1], ".h"))
-                {
-                    strcpy(outFileName, argv[i + 1]);   // Read output filename
-                }
-                else LOG("WARNING: Output file extension not recognized\n");
+        if (count == 1) break;
+        count = (count + 1)/2;
+    }
 
-                i++;
-            }
-            else LOG("WARNING: No output file provided\n");
-        }
-        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--format") == 0))
-        {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
-            {
-                int numValues = 0;
-                char **values = TextSplit(argv[i + 1], ',', &numValues);
+    peaks.levels[0] = (WavePeak *)RL_CALLOC(totalCount, sizeof(WavePeak));
+    for (int l = 1; l < peaks.levelCount; l++) peaks.levels[l] = peaks.levels[l - 1] + peaks.count[l - 1];
 
-                if (numValues != 3) LOG("WARNING: Incorrect number of format values\n");
-                else
-                {
-                    // Read values text and convert to integer values
-                    sampleRate = TextToInteger(values[0]);
-                    sampleSize = TextToInteger(values[1]);
-                    channels = TextToInteger(values[2]);
+    // First level, computed from wave frames
+    const float *frames = (const float *)wave.data;
 
-                    // Verify retrieved values are valid
-                    if ((sampleRate != 44100) && (sampleRate != 22050))
-                    {
-                        LOG("WARNING: Sample rate not supported. Default: 44100 Hz\n");
-                        sampleRate = 44100;
-                    }
+    for (unsigned int i = 0; i < peaks.count[0]; i++)
+    {
+        unsigned int start = i*WAVE_PEAKS_BLOCK_FRAMES;
+        unsigned int end = start + WAVE_PEAKS_BLOCK_FRAMES;
+        if (end > wave.frameCount) end = wave.frameCount;
 
-                    if ((sampleSize != 8) && (sampleSize != 16) && (sampleSize != 32))
-                    {
-                        LOG("WARNING: Sample size not supported. Default: 16 bit\n");
-                        sampleSize = 16;
-                    }
+        WavePeak peak = { frames[start], frames[start], 0.0f };
 
-                    if ((channels != 1) && (channels != 2))
-                    {
-                        LOG("WARNING: Channels number not supported. Default: 1 (mono)\n");
-                        channels = 1;
-                    }
-                }
-            }
-            else LOG("WARNING: Format parameters provided not valid\n");
+        for (unsigned int f = start; f < end; f++)
+        {
+            if (frames[f] < peak.min) peak.min = frames[f];
+            if (frames[f] > peak.max) peak.max = frames[f];
+            peak.power += frames[f]*frames[f];
         }
-        else if ((strcmp(argv[i], "-p") == 0) || (strcmp(argv[i], "--play") == 0))
+
+        peak.power /= (float)(end - start);
+        peaks.levels[0][i] = peak;
+    }
+
+    // Next levels, every peak merges two peaks of previous level
+    // NOTE: Last block of every level can be shorter, mean square is weighted by frames
+    for (int l = 1; l < peaks.levelCount; l++)
+    {
+        unsigned int blockFrames = WAVE_PEAKS_BLOCK_FRAMES << (l - 1);
+
+        for (unsigned int i = 0; i < peaks.count[l]; i++)
         {
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            WavePeak peak = peaks.levels[l - 1][i*2];
+
+            if ((i*2 + 1) < peaks.count[l - 1])
             {
-                if (IsFileExtension(argv[i + 1], ".wav") ||
-                    IsFileExtension(argv[i + 1], ".qoa") ||
-                    IsFileExtension(argv[i + 1], ".ogg") ||
-                    IsFileExtension(argv[i + 1], ".flac") ||
-                    IsFileExtension(argv[i + 1], ".mp3"))
-                {
-                    strcpy(playFileName, argv[i + 1]);   // Read filename to play
-                    i++;
-                }
-                else LOG("WARNING: Play file format not supported\n");
+                WavePeak next = peaks.levels[l - 1][i*2 + 1];
+                unsigned int nextFrames = wave.frameCount - (i*2 + 1)*blockFrames;
+                if (nextFrames > blockFrames) nextFrames = blockFrames;
 
-                i++;
+                if (next.min < peak.min) peak.min = next.min;
+                if (next.max > peak.max) peak.max = next.max;
+                peak.power = (peak.power*blockFrames + next.power*nextFrames)/(float)(blockFrames + nextFrames);
             }
-            else LOG("WARNING: No file to play provided\n");
-        }
-        else if ((strcmp(argv[i], "-g") == 0) || (strcmp(argv[i], "--generate") == 0))
-        {
-            strcpy(presetType, argv[i + 1]); // Saves the preset to generate
+
+            peaks.levels[l][i] = peak;
         }
     }
 
-    // Wave that will be generated in case an input file or preset type is provided
-    Wave wave = { 0 };
+    return peaks;
+}
 
-    // Process input file if provided
-    if (inFileName[0] != '\0')
+// Unload wave peaks pyramid
+static void UnloadWavePeaks(WavePeaks peaks)
+{
+    RL_FREE(peaks.levels[0]);
+}
+
+// Get wave peak for frames range (exact values)
+// NOTE: Range inner blocks are covered by biggest blocks available (two per level at most),
+// range edges not aligned to first level blocks are computed from wave frames
+static WavePeak GetWavePeak(WavePeaks *peaks, Wave *wave, unsigned int start, unsigned int end)
+{
+    const float *frames = (const float *)wave->data;
+    WavePeak peak = { frames[start], frames[start], 0.0f };
+
+    // Get range inner blocks (first level), last block can be shorter
+    unsigned int first = (start + WAVE_PEAKS_BLOCK_FRAMES - 1)/WAVE_PEAKS_BLOCK_FRAMES;
+    unsigned int last = (end == peaks->frameCount)? peaks->count[0] : end/WAVE_PEAKS_BLOCK_FRAMES;
+    if (first > last) last = first;
+
+    unsigned int innerStart = first*WAVE_PEAKS_BLOCK_FRAMES;
+    unsigned int innerEnd = (last > first)? last*WAVE_PEAKS_BLOCK_FRAMES : innerStart;
+
+    // Range edges, computed from wave frames
+    for (unsigned int f = start; f < end; f++)
     {
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.wav");  // Set a default name for output in case not provided
+        if (f == innerStart) f = innerEnd;
+        if (f >= end) break;
 
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
-        LOG("\nOutput format:    %i Hz, %i bits, %s\n\n", sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
+        if (frames[f] < peak.min) peak.min = frames[f];
+        if (frames[f] > peak.max) peak.max = frames[f];
+        peak.power += frames[f]*frames[f];
+    }
 
-        if (IsFileExtension(inFileName, ".rfx")) // || IsFileExtension(inFileName, ".sfs"))
-        {
-            WaveParams params = LoadWaveParams(inFileName);
+    // Range inner blocks, only edge blocks are used on every level, inner ones are merged in next level
+    for (int l = 0; (l < peaks->levelCount) && (first < last); l++)
+    {
+        unsigned int blockFrames = WAVE_PEAKS_BLOCK_FRAMES << l;
+        unsigned int nextFirst = first;
+        unsigned int nextLast = first;      // Last level, all blocks used
 
-            // NOTE: GenerateWave() returns data as 32bit float, 1 channel by default
-            wave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
-            wave.sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
-            wave.channels = RFXGEN_GEN_CHANNELS;
-            wave.data = GenerateWave(params, &wave.frameCount);
+        if ((l + 1) < peaks->levelCount)
+        {
+            nextFirst = first + (first & 1);
+            nextLast = last - (last & 1);
         }
-        else if (IsFileExtension(inFileName, ".wav") ||
-                 IsFileExtension(inFileName, ".qoa") ||
-                 IsFileExtension(inFileName, ".ogg") ||
-                 IsFileExtension(inFileName, ".flac") ||
-                 IsFileExtension(inFileName, ".mp3"))
+
+        for (unsigned int i = first; i < last; i++)
         {
-            wave = LoadWave(inFileName);
+            if (i == nextFirst) i = nextLast;
+            if (i >= last) break;
+
+            WavePeak block = peaks->levels[l][i];
+            unsigned int frameCount = blockFrames;
+            if ((i + 1)*blockFrames > peaks->frameCount) frameCount = peaks->frameCount - i*blockFrames;
+
+            if (block.min < peak.min) peak.min = block.min;
+            if (block.max > peak.max) peak.max = block.max;
+            peak.power += block.power*frameCount;
         }
 
+        first = nextFirst/2;
+        last = nextLast/2;
     }
 
-    // Process generate sound if type provided
-    if (presetType[0] != '\0')
+    peak.power /= (float)(end - start);
+
+    return peak;
+}
+
+// Draw wave frames range using peaks, one column per pixel (min to max line) and rms
+static void DrawWavePeaks(WavePeaks *peaks, Wave *wave, unsigned int start, unsigned int end, Rectangle bounds, Color color)
+{
+    if ((peaks->levelCount == 0) || (end <= start) || (end > peaks->frameCount)) return;
+
+    int columns = (int)bounds.width;
+    float framesPerColumn = (float)(end - start)/(float)columns;
+    float halfHeight = bounds.height/2;
+    Color peakColor = Fade(color, 0.6f);
+
+    for (int i = 0; i < columns; i++)
     {
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.wav");
+        unsigned int columnStart = start + (unsigned int)(framesPerColumn*i);
+        unsigned int columnEnd = start + (unsigned int)(framesPerColumn*(i + 1));
+        if (columnEnd <= columnStart) columnEnd = columnStart + 1;
+        if (columnEnd > end) columnEnd = end;
+        if (columnStart >= columnEnd) break;
+
+        WavePeak peak = GetWavePeak(peaks, wave, columnStart, columnEnd);
+
+        float min = peak.min*bounds.height;
+        float max = peak.max*bounds.height;
+        float rms = sqrtf(peak.power)*bounds.height;
+
+        if (min < -halfHeight) min = -halfHeight;
+        if (max > halfHeight) max = halfHeight;
+        if (rms > halfHeight) rms = halfHeight;
+
+        // NOTE: Lines are drawn at least one pixel long, silent parts are shown as a flat line
+        float x = bounds.x + (float)i + 0.5f;
+        DrawLineV((Vector2){ x, bounds.y + halfHeight + min }, (Vector2){ x, bounds.y + halfHeight + max + 1.0f }, peakColor);
+        DrawLineV((Vector2){ x, bounds.y + halfHeight - rms }, (Vector2){ x, bounds.y + halfHeight + rms + 1.0f }, color);
+    }
+}
 
-        wave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
-        wave.sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
-        wave.channels = RFXGEN_GEN_CHANNELS;
-
-        if (strcmp(presetType, "coin") == 0)            wave.data = GenerateWave(GenPickupCoin(), &wave.frameCount);
-        else if (strcmp(presetType, "laser") == 0)      wave.data = GenerateWave(GenLaserShoot(), &wave.frameCount);
-        else if (strcmp(presetType, "explosion") == 0)  wave.data = GenerateWave(GenExplosion(), &wave.frameCount);
-        else if (strcmp(presetType, "powerup") == 0)    wave.data = GenerateWave(GenPowerup(), &wave.frameCount);
-        else if (strcmp(presetType, "hit") == 0)        wave.data = GenerateWave(GenHitHurt(), &wave.frameCount);
-        else if (strcmp(presetType, "jump") == 0)       wave.data = GenerateWave(GenJump(), &wave.frameCount);
-        else if (strcmp(presetType, "blip") == 0)       wave.data = GenerateWave(GenBlipSelect(), &wave.frameCount);
-        else LOG("Unrecognized type of preset.\n");
+// Update sound from wave (32bit float, mono), sound audio buffer is reused if wave fits
+// NOTE: Wave is converted to sound format (device sample rate and channels) by raudio converter,
+// same conversion than LoadSoundFromWave(), sound buffer remaining frames are silenced using
+// provided frames buffer (only grows), sound played length can not be changed without reloading it
+// WARNING: Sound is reloaded if not loaded, sound format is not 32bit float, wave does not fit or
+// wave is shorter than sound by more than SOUND_UPDATE_MAX_SILENCE (trailing silence played),
+// also if frames buffer can not be grown
+static void UpdateSoundFromWave(Sound *sound, Wave wave, float **frames, unsigned int *framesSize)
+{
+    if ((wave.data == NULL) || (wave.frameCount == 0)) return;
+
+    unsigned int channels = sound->stream.channels;
+    unsigned int maxSilence = (unsigned int)(SOUND_UPDATE_MAX_SILENCE*sound->stream.sampleRate);
+    bool reload = ((sound->stream.buffer == NULL) || (sound->stream.sampleSize != 32));
+    Wave converted = { 0 };
+
+    if (!reload)
+    {
+        converted = WaveCopy(wave);
+        WaveFormat(&converted, sound->stream.sampleRate, 32, channels);
+
+        reload = ((converted.data == NULL) || (converted.frameCount > sound->frameCount) ||
+                  ((converted.frameCount + maxSilence) < sound->frameCount));
     }
 
-    // Save the generated wave data if valid
-    if (wave.data != NULL)
+    if (reload)
+    {
+        UnloadSound(*sound);
+        *sound = LoadSoundFromWave(wave);
+    }
+    else if (converted.frameCount == sound->frameCount) UpdateSound(*sound, converted.data, sound->frameCount);
+    else
     {
-        // Format wave data to desired sampleRate, sampleSize and channels
-        WaveFormat(&wave, sampleRate, sampleSize, channels);
+        unsigned int size = sound->frameCount*channels;
 
-        // Export wave data as audio file (.wav) or code file (.h)
-        if (IsFileExtension(outFileName, ".wav") || IsFileExtension(outFileName, ".qoa")) ExportWave(wave, outFileName);
-        else if (IsFileExtension(outFileName, ".h")) ExportWaveAsCode(wave, outFileName);
-        else if (IsFileExtension(outFileName, ".raw"))
+        if (size > *framesSize)
         {
-            // Export Wave as RAW data
-            FILE *rawFile = fopen(outFileName, "wb");
-
-            if (rawFile != NULL)
-            {
-                fwrite(wave.data, 1, wave.frameCount*wave.channels*wave.sampleSize/8, rawFile);  // Write wave data
-                fclose(rawFile);
-            }
+            RL_FREE(*frames);
+            *frames = (float *)RL_CALLOC(size, sizeof(float));
+            *framesSize = (*frames != NULL)? size : 0;
         }
 
-        UnloadWave(wave);
+        if (*frames != NULL)
+        {
+            memcpy(*frames, converted.data, converted.frameCount*channels*sizeof(float));
+            memset(*frames + converted.frameCount*channels, 0, (size - converted.frameCount*channels)*sizeof(float));
+
+            UpdateSound(*sound, *frames, sound->frameCount);
+        }
+        else
+        {
+            UnloadSound(*sound);
+            *sound = LoadSoundFromWave(wave);
+        }
     }
 
-    // Play audio file if provided
-    if (playFileName[0] != '\0')
+    UnloadWave(converted);
+}
+
+// Generate wave parameters from source: presets (0-6), random (7) or mutation of provided parameters (8)
+// NOTE: Same sources order than generator buttons
+static WaveParams GenSourceWaveParams(int source, WaveParams params)
+{
+    switch (source)
     {
-        Wave wave = LoadWave(playFileName);     // Load audio (WAV, QOA, OGG, FLAC, MP3)
-        PlayWaveCLI(wave);
-        UnloadWave(wave);
+        case 0: params = GenPickupCoin(); break;
+        case 1: params = GenLaserShoot(); break;
+        case 2: params = GenExplosion(); break;
+        case 3: params = GenPowerup(); break;
+        case 4: params = GenHitHurt(); break;
+        case 5: params = GenJump(); break;
+        case 6: params = GenBlipSelect(); break;
+        case 7: params = GenRandomize(); break;
+        default: WaveMutate(&params); break;
     }
 
-    if (showUsageInfo) ShowCommandLineInfo();
+    return params;
 }
-#endif // PLATFORM_DESKTOP
 
 //--------------------------------------------------------------------------------------------
-// Auxiliar functions
+// Sound list functions
 //--------------------------------------------------------------------------------------------
-// Draw wave data
-// NOTE: For proper visualization, MSAA x4 is recommended but it could be costly for the GPU
-// Alternative: Rendered to a bigger texture and scale down with bilinear/trilinear texture filtering
-static void DrawWave(Wave *wave, Rectangle bounds, Color color)
+// Add sound list entry (not rendered), returns entry index (-1 on allocation failure)
+// NOTE: Entries array grows by doubling, entries are moved
+static int AddSoundEntry(SoundList *list, WaveParams params, const char *name, bool empty)
 {
-    float sample = 0.0f;
-    float sampleNext = 0.0f;
-    float currentSample = 0.0f;
-    float sampleIncrement = (float)wave->frameCount*wave->channels/(float)(bounds.width*2);
-    float sampleScale = (float)bounds.height;
-
-    for (int i = 1; i < bounds.width*2 - 1; i++)
+    if (list->count == list->capacity)
     {
-        sample = ((float *)wave->data)[(int)currentSample]*sampleScale;
-        sampleNext = ((float *)wave->data)[(int)(currentSample + sampleIncrement)]*sampleScale;
+        int capacity = (list->capacity > 0)? list->capacity*2 : 16;
+        SoundEntry *entries = (SoundEntry *)RL_REALLOC(list->entries, capacity*sizeof(SoundEntry));
 
-        if (sample > bounds.height/2) sample = bounds.height/2;
-        else if (sample < -bounds.height/2) sample = -bounds.height/2;
+        if (entries == NULL) return -1;
 
-        if (sampleNext > bounds.height/2) sampleNext = bounds.height/2;
-        else if (sampleNext < -bounds.height/2) sampleNext = -bounds.height/2;
+        list->entries = entries;
+        list->capacity = capacity;
+    }
 
-        DrawLineV((Vector2){ (float)bounds.x + (float)i/2.0f, (float)(bounds.y + bounds.height/2) + sample },
-                  (Vector2){ (float)bounds.x + (float)i/2.0f, (float)(bounds.y  + bounds.height/2) + sampleNext }, color);
+    SoundEntry *entry = &list->entries[list->count];
+    memset(entry, 0, sizeof(SoundEntry));
 
-        currentSample += sampleIncrement;
-    }
+    entry->params = params;
+    if (name != NULL) strncpy(entry->name, name, sizeof(entry->name) - 1);
+    entry->empty = empty;
+
+    // Default wave values, no wave data until rendered
+    entry->wave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+    entry->wave.sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
+    entry->wave.channels = RFXGEN_GEN_CHANNELS;
+
+    return list->count++;
 }
 
-#if defined(PLATFORM_DESKTOP)
-// Simple time wait in milliseconds
-static void WaitTimePlayer(int ms)
+// Remove sound list entry, rendered wave unloaded and next entries moved
+static void RemoveSoundEntry(SoundList *list, int index)
 {
-    if (ms > 0)
-    {
-        int currentTime = clock()*1000/CLOCKS_PER_SEC;  // Current time in milliseconds
-        int totalTime = currentTime + ms;               // Total required time in ms to return from this timeout
+    if ((index < 0) || (index >= list->count)) return;
 
-        int percent = 0;
-        int prevPercent = percent;
+    UnloadSoundEntryWave(list, index);
+    memmove(&list->entries[index], &list->entries[index + 1], (list->count - index - 1)*sizeof(SoundEntry));
+    list->count--;
+}
 
-        // Wait until current ms time matches total ms time
-        while (currentTime <= totalTime)
-        {
-            // Check for key pressed to stop playing
-            if (kbhit())
-            {
-                int key = getch();
-                if ((key == 13) || (key == 27)) break;    // KEY_ENTER || KEY_ESCAPE
-            }
+// Set sound list entry rendered wave and peaks, previous ones unloaded
+// NOTE: Wave and peaks ownership is transferred to list
+static void SetSoundEntryWave(SoundList *list, int index, Wave wave, WavePeaks peaks, bool draft)
+{
+    UnloadSoundEntryWave(list, index);
 
-            currentTime = clock()*1000/CLOCKS_PER_SEC;
+    SoundEntry *entry = &list->entries[index];
+    entry->wave = wave;
+    entry->peaks = peaks;
+    entry->draft = draft;
+    entry->empty = false;
 
-            // Print console time bar
-            percent = (int)(((float)currentTime/totalTime)*100.0f);
+    // Memory size: wave data and peaks levels (allocated in one block)
+    entry->size = wave.frameCount*wave.channels*wave.sampleSize/8;
+    for (int i = 0; i < peaks.levelCount; i++) entry->size += peaks.count[i]*sizeof(WavePeak);
 
-            if (percent != prevPercent)
-            {
-                LOG("\r[");
-                for (int j = 0; j < 50; j++)
-                {
-                    if (j < percent/2) LOG("=");
-                    else LOG(" ");
-                }
-                LOG("] [%02i%%]", percent);
+    list->memoryUsed += entry->size;
+}
 
-                prevPercent = percent;
-            }
+// Unload sound list entry rendered wave and peaks, parameters are kept
+// NOTE: Wave format is kept, entry is rendered again when required
+static void UnloadSoundEntryWave(SoundList *list, int index)
+{
+    SoundEntry *entry = &list->entries[index];
+
+    UnloadWave(entry->wave);
+    UnloadWavePeaks(entry->peaks);
+
+    entry->wave.data = NULL;
+    entry->wave.frameCount = 0;
+    entry->peaks = (WavePeaks){ 0 };
+    entry->draft = false;
+
+    list->memoryUsed -= entry->size;
+    entry->size = 0;
+}
+
+// Evict least recently used entries rendered waves until memory used fits budget
+// NOTE: Entries used on provided frame (current entry, visible rows) are never evicted
+static void EvictSoundList(SoundList *list, unsigned int budget, unsigned int frame)
+{
+    while (list->memoryUsed > budget)
+    {
+        int oldest = -1;
+
+        for (int i = 0; i < list->count; i++)
+        {
+            if ((list->entries[i].wave.data != NULL) && (list->entries[i].lastUsed != frame) &&
+                ((oldest < 0) || (list->entries[i].lastUsed < list->entries[oldest].lastUsed))) oldest = i;
         }
 
-        LOG("\n\n");
+        if (oldest < 0) break;      // Only entries in use rendered, budget exceeded meanwhile
+
+        UnloadSoundEntryWave(list, oldest);
     }
 }
 
-// Play provided wave through CLI
-static void PlayWaveCLI(Wave wave)
+// Unload sound list entries, rendered waves and entries array
+static void UnloadSoundList(SoundList *list)
 {
-    float waveTimeMs = (float)wave.frameCount*1000.0f/wave.sampleRate;
-
-    InitAudioDevice();                  // Init audio device
-    Sound fx = LoadSoundFromWave(wave); // Load audio wave
-
-    printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
-    printf("//                                                                              //\n");
-    printf("// %s v%s - CLI audio player                                         //\n", toolName, toolVersion);
-    printf("//                                                                              //\n");
-    printf("// more info and bugs-report: github.com/raysan5/rfxgen                         //\n");
-    printf("//                                                                              //\n");
-    printf("// Copyright (c) 2020-2026 raylib technologies (@raylibtech)                    //\n");
-    printf("//                                                                              //\n");
-    printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
-
-    printf("Playing sound [%.2f sec.]. Press ENTER to finish.\n", waveTimeMs/1000.0f);
-
-    PlaySound(fx);                      // Play sound
-    WaitTimePlayer(waveTimeMs);         // Wait while audio is playing
-    UnloadSound(fx);                    // Unload sound data
-    CloseAudioDevice();                 // Close audio device
+    for (int i = 0; i < list->count; i++) UnloadSoundEntryWave(list, i);
+
+    RL_FREE(list->entries);
+    *list = (SoundList){ 0 };
 }
 
-#if !defined(_WIN32)
-// Check if key has been pressed
-static int kbhit(void)
+//--------------------------------------------------------------------------------------------
+// Wave generation worker functions
+//--------------------------------------------------------------------------------------------
+// Init wave worker, background thread started
+// NOTE: If thread can not be created, requests are generated immediately
+static void InitWaveWorker(WaveWorker *worker)
 {
-    struct termios oldt = { 0 };
-    struct termios newt = { 0 };
-    int ch = 0;
-    int oldf = 0;
+    memset(worker, 0, sizeof(WaveWorker));
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreInit(&worker->lock, 1);
+    RfxSemaphoreInit(&worker->signal, 0);
+
+    worker->running = RfxThreadCreate(&worker->thread, WaveWorkerThread, worker);
+    if (!worker->running) LOG("WARNING: Wave worker thread could not be created\n");
+#endif
+}
 
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-    fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
+// Request wave generation, replaces any previous request (latest request wins)
+// NOTE: Returns request id, required to read request frames while generating
+static unsigned int RequestWaveWorker(WaveWorker *worker, WaveParams params, int slot, bool draft)
+{
+    unsigned int id = 0;
 
-    ch = getchar();
+#if defined(SUPPORT_WAVE_WORKER)
+    if (worker->running)
+    {
+        RfxSemaphoreWait(&worker->lock);
+        id = ++worker->requestId;
+        worker->requested = true;
+        worker->params = params;
+        worker->slot = slot;
+        worker->draft = draft;
+        RfxSemaphorePost(&worker->lock);
+
+        RfxSemaphorePost(&worker->signal);
+        return id;
+    }
+#endif
+    // No worker available, wave generated immediately
+    id = ++worker->requestId;
 
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    fcntl(STDIN_FILENO, F_SETFL, oldf);
+    Wave wave = { 0 };
 
-    if (ch != EOF)
+    if (GenerateWaveWorker(worker, params, id, draft, &wave))
     {
-        ungetc(ch, stdin);
-        return 1;
+        if (worker->ready) UnloadWave(worker->wave);
+        worker->wave = wave;
+        worker->waveSlot = slot;
+        worker->waveDraft = draft;
+        worker->ready = true;
     }
 
-    return 0;
+    return id;
+}
+
+// Cancel current request, in-flight generation and not retrieved result are discarded
+static void CancelWaveWorker(WaveWorker *worker)
+{
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
+#endif
+    worker->requestId++;
+    worker->requested = false;
+
+    if (worker->ready) UnloadWave(worker->wave);
+    worker->ready = false;
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
 }
+
+// Get request frames generated so far, from provided offset
+// NOTE: Returns number of frames copied, finished is set once all request frames have been read
+// or request has been replaced/cancelled
+static unsigned int GetWaveWorkerFrames(WaveWorker *worker, unsigned int id, unsigned int offset, float *frames, unsigned int frameCount, bool *finished)
+{
+    unsigned int count = 0;
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
 #endif
-#endif // PLATFORM_DESKTOP
+    if (worker->requestId != id) *finished = true;     // Request replaced or cancelled
+    else if (worker->framesId != id) *finished = false; // Request generation not started yet
+    else
+    {
+        if (offset < worker->framesCount) count = worker->framesCount - offset;
+        if (count > frameCount) count = frameCount;
+
+        if (count > 0) memcpy(frames, worker->frames + offset, count*sizeof(float));
+
+        *finished = worker->framesDone && ((offset + count) == worker->framesCount);
+    }
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
+
+    return count;
+}
+
+// Get generated wave if ready, wave ownership is transferred to caller
+static bool GetWaveWorkerResult(WaveWorker *worker, Wave *wave, int *slot, bool *draft)
+{
+    bool ready = false;
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
+#endif
+    if (worker->ready)
+    {
+        *wave = worker->wave;
+        *slot = worker->waveSlot;
+        *draft = worker->waveDraft;
+
+        worker->ready = false;
+        ready = true;
+    }
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
+
+    return ready;
+}
+
+// Close wave worker, waiting for thread to finish
+// NOTE: In-flight generation is cancelled, not retrieved result is unloaded
+static void CloseWaveWorker(WaveWorker *worker)
+{
+#if defined(SUPPORT_WAVE_WORKER)
+    if (worker->running)
+    {
+        RfxSemaphoreWait(&worker->lock);
+        worker->quit = true;
+        RfxSemaphorePost(&worker->lock);
+
+        RfxSemaphorePost(&worker->signal);
+        RfxThreadJoin(worker->thread);
+        worker->running = false;
+    }
+
+    RfxSemaphoreUnload(&worker->lock);
+    RfxSemaphoreUnload(&worker->signal);
+#endif
+    if (worker->ready) UnloadWave(worker->wave);
+    worker->ready = false;
+
+    RL_FREE(worker->frames);
+    worker->frames = NULL;
+}
+
+// Generate wave by blocks, checking for cancellation (newer request) between blocks
+// NOTE: Generated frames are published by block, so they can be read while generating,
+// returns false if generation is cancelled or wave data can not be allocated (failed generation)
+// NOTE: Draft waves are generated with lower supersampling and truncated length (faster)
+static bool GenerateWaveWorker(WaveWorker *worker, WaveParams params, unsigned int id, bool draft, Wave *wave)
+{
+    WaveGenerator generator = LoadWaveGenerator(params);
+
+    if (!IsWaveGeneratorValid(generator)) return false;
+
+    unsigned int maxFrameCount = WAVE_WORKER_MAX_FRAMES;
+
+    if (draft)
+    {
+        SetWaveGeneratorQuality(&generator, WAVE_DRAFT_SUPERSAMPLING);
+        maxFrameCount = WAVE_DRAFT_MAX_FRAMES;
+    }
+
+    // NOTE: Frames buffer is allocated once for max wave length (no reallocations while frames are read),
+    // it is reused by every request, previous request frames are not read anymore once request id changes
+    if (worker->frames == NULL) worker->frames = (float *)RL_CALLOC(WAVE_WORKER_MAX_FRAMES, sizeof(float));
+
+    float *frames = worker->frames;
+    unsigned int frameCount = 0;
+    bool cancelled = (frames == NULL);  // Frames buffer not allocated, request finished with no frames
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
+#endif
+    worker->framesId = id;
+    worker->framesCount = 0;
+    worker->framesDone = false;
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
+
+    while (!cancelled)
+    {
+        unsigned int count = maxFrameCount - frameCount;
+        if (count > WAVE_WORKER_BLOCK_FRAMES) count = WAVE_WORKER_BLOCK_FRAMES;
+
+        count = GenerateWaveFrames(&generator, frames + frameCount, count);
+        if (count == 0) break;
+
+        frameCount += count;
+
+#if defined(SUPPORT_WAVE_WORKER)
+        RfxSemaphoreWait(&worker->lock);
+        worker->framesCount = frameCount;
+        cancelled = worker->quit || (worker->requestId != id);
+        RfxSemaphorePost(&worker->lock);
+#else
+        worker->framesCount = frameCount;
+#endif
+    }
+
+    UnloadWaveGenerator(generator);
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
+#endif
+    worker->framesDone = true;
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
+
+    if (!cancelled)
+    {
+        // Generated wave is copied with its final size, frames buffer can still be in use for reading
+        wave->frameCount = frameCount;
+        wave->sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+        wave->sampleSize = 32;
+        wave->channels = 1;
+        wave->data = RL_CALLOC(frameCount + 1, sizeof(float));    // NOTE: One extra frame, avoid zero-size allocation
+
+        if (wave->data != NULL) memcpy(wave->data, frames, frameCount*sizeof(float));
+        else cancelled = true;
+    }
+
+    return !cancelled;
+}
+
+#if defined(SUPPORT_WAVE_WORKER)
+// Wave worker thread function, waits for requests and generates latest one
+static void WaveWorkerThread(void *data)
+{
+    WaveWorker *worker = (WaveWorker *)data;
+
+    while (true)
+    {
+        RfxSemaphoreWait(&worker->signal);
+
+        // Get latest request, several signals can be received for one request (or cancelled ones)
+        RfxSemaphoreWait(&worker->lock);
+        bool quit = worker->quit;
+        bool requested = worker->requested;
+        unsigned int id = worker->requestId;
+        WaveParams params = worker->params;
+        int slot = worker->slot;
+        bool draft = worker->draft;
+        worker->requested = false;
+        RfxSemaphorePost(&worker->lock);
+
+        if (quit) break;
+        if (!requested) continue;
+
+        Wave wave = { 0 };
+        bool generated = GenerateWaveWorker(worker, params, id, draft, &wave);
+
+        // Result is only kept if no newer request has been received meanwhile
+        RfxSemaphoreWait(&worker->lock);
+        if (generated && (worker->requestId == id) && !worker->quit)
+        {
+            if (worker->ready) UnloadWave(worker->wave);
+            worker->wave = wave;
+            worker->waveSlot = slot;
+            worker->waveDraft = draft;
+            worker->ready = true;
+        }
+        else if (generated) UnloadWave(wave);
+        RfxSemaphorePost(&worker->lock);
+    }
+}
+#endif
+
+//--------------------------------------------------------------------------------------------
+// Spectrogram worker functions
+//--------------------------------------------------------------------------------------------
+// Init spectrogram worker, FFT tables computed and background thread started
+// NOTE: Without threads support, requests are computed immediately
+static void InitSpectrogramWorker(SpectrogramWorker *worker, int width, int height)
+{
+    memset(worker, 0, sizeof(SpectrogramWorker));
+
+    worker->width = width;
+    worker->height = height;
+
+    for (int i = 0; i < SPECTROGRAM_FFT_SIZE; i++) worker->window[i] = 0.5f - 0.5f*cosf(2.0f*PI*i/SPECTROGRAM_FFT_SIZE);
+
+    for (int i = 0; i < SPECTROGRAM_FFT_SIZE/2; i++)
+    {
+        worker->cosTable[i] = cosf(2.0f*PI*i/SPECTROGRAM_FFT_SIZE);
+        worker->sinTable[i] = sinf(2.0f*PI*i/SPECTROGRAM_FFT_SIZE);
+    }
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreInit(&worker->lock, 1);
+    RfxSemaphoreInit(&worker->signal, 0);
+
+    worker->running = RfxThreadCreate(&worker->thread, SpectrogramWorkerThread, worker);
+    if (!worker->running) LOG("WARNING: Spectrogram worker thread could not be created\n");
+#endif
+}
+
+// Request wave spectrogram, replaces any previous request (latest request wins)
+// NOTE: Wave data is copied (it can be unloaded after request), previous result not retrieved is discarded
+static void RequestSpectrogramWorker(SpectrogramWorker *worker, Wave wave)
+{
+    Wave copy = WaveCopy(wave);
+
+#if defined(SUPPORT_WAVE_WORKER)
+    if (worker->running)
+    {
+        RfxSemaphoreWait(&worker->lock);
+        worker->requestId++;
+        if (worker->requested) UnloadWave(worker->wave);    // Previous request not started, discarded
+        RL_FREE(worker->levels);                            // Previous result not retrieved, obsolete
+        worker->levels = NULL;
+        worker->ready = false;
+        worker->requested = true;
+        worker->wave = copy;
+        RfxSemaphorePost(&worker->lock);
+
+        RfxSemaphorePost(&worker->signal);
+        return;
+    }
+#endif
+    // No worker available, spectrogram computed immediately
+    unsigned char *levels = (unsigned char *)RL_CALLOC(worker->width*worker->height, 1);
+
+    ComputeSpectrogram(worker, copy, ++worker->requestId, levels);
+    UnloadWave(copy);
+
+    RL_FREE(worker->levels);
+    worker->levels = levels;
+    worker->ready = true;
+}
+
+// Get computed spectrogram levels if ready, levels ownership is transferred to caller
+// NOTE: Previous levels provided are freed
+static bool GetSpectrogramWorkerResult(SpectrogramWorker *worker, unsigned char **levels)
+{
+    bool ready = false;
+
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphoreWait(&worker->lock);
+#endif
+    if (worker->ready)
+    {
+        RL_FREE(*levels);
+        *levels = worker->levels;
+
+        worker->levels = NULL;
+        worker->ready = false;
+        ready = true;
+    }
+#if defined(SUPPORT_WAVE_WORKER)
+    RfxSemaphorePost(&worker->lock);
+#endif
+
+    return ready;
+}
+
+// Close spectrogram worker, waiting for thread to finish
+// NOTE: In-flight computation is cancelled, not started request and not retrieved result are unloaded
+static void CloseSpectrogramWorker(SpectrogramWorker *worker)
+{
+#if defined(SUPPORT_WAVE_WORKER)
+    if (worker->running)
+    {
+        RfxSemaphoreWait(&worker->lock);
+        worker->quit = true;
+        RfxSemaphorePost(&worker->lock);
+
+        RfxSemaphorePost(&worker->signal);
+        RfxThreadJoin(worker->thread);
+        worker->running = false;
+    }
+
+    RfxSemaphoreUnload(&worker->lock);
+    RfxSemaphoreUnload(&worker->signal);
+#endif
+    if (worker->requested) UnloadWave(worker->wave);
+    worker->requested = false;
+
+    RL_FREE(worker->levels);
+    worker->levels = NULL;
+    worker->ready = false;
+}
+
+// Compute spectrogram levels (width*height), one column per time range of the wave
+// NOTE: Long waves are analyzed with several windows per column (max level kept), so short
+// transients are not skipped, returns false if computation is cancelled
+static bool ComputeSpectrogram(SpectrogramWorker *worker, Wave wave, unsigned int id, unsigned char *levels)
+{
+    const int binCount = SPECTROGRAM_FFT_SIZE/2;
+    const float *data = (const float *)wave.data;
+
+    // Reference power: full scale sine, Hann window peak is N/4
+    const float refPower = (SPECTROGRAM_FFT_SIZE/4.0f)*(SPECTROGRAM_FFT_SIZE/4.0f);
+
+    float re[SPECTROGRAM_FFT_SIZE/2] = { 0 };
+    float im[SPECTROGRAM_FFT_SIZE/2] = { 0 };
+    float power[SPECTROGRAM_FFT_SIZE/2] = { 0 };
+    float columnPower[SPECTROGRAM_FFT_SIZE/2] = { 0 };
+
+    if (wave.frameCount == 0) return true;
+
+    float framesPerColumn = (float)wave.frameCount/(float)worker->width;
+    int windowCount = (int)ceilf(framesPerColumn/(SPECTROGRAM_FFT_SIZE/2));
+    if (windowCount < 1) windowCount = 1;
+
+    for (int x = 0; x < worker->width; x++)
+    {
+#if defined(SUPPORT_WAVE_WORKER)
+        // Check cancellation (newer request) every few columns
+        if ((x%32) == 0)
+        {
+            RfxSemaphoreWait(&worker->lock);
+            bool cancelled = worker->quit || (worker->requestId != id);
+            RfxSemaphorePost(&worker->lock);
+
+            if (cancelled) return false;
+        }
+#endif
+        memset(columnPower, 0, binCount*sizeof(float));
+
+        for (int w = 0; w < windowCount; w++)
+        {
+            // Window centered on column time range part, frames out of wave are zero
+            int center = (int)(framesPerColumn*(x + (w + 0.5f)/windowCount));
+            int start = center - SPECTROGRAM_FFT_SIZE/2;
+
+            for (int i = 0; i < SPECTROGRAM_FFT_SIZE/2; i++)
+            {
+                int even = start + 2*i;
+                int odd = even + 1;
+
+                re[i] = ((even >= 0) && (even < (int)wave.frameCount))? data[even]*worker->window[2*i] : 0.0f;
+                im[i] = ((odd >= 0) && (odd < (int)wave.frameCount))? data[odd]*worker->window[2*i + 1] : 0.0f;
+            }
+
+            ComputeSpectrum(worker, re, im, power);
+
+            for (int k = 0; k < binCount; k++) if (power[k] > columnPower[k]) columnPower[k] = power[k];
+        }
+
+        // Frequency bins merged into rows (max level), top row is highest frequency
+        for (int y = 0; y < worker->height; y++)
+        {
+            int row = worker->height - 1 - y;
+            int firstBin = row*binCount/worker->height;
+            int lastBin = (row + 1)*binCount/worker->height;
+            if (lastBin <= firstBin) lastBin = firstBin + 1;
+
+            float maxPower = 0.0f;
+            for (int k = firstBin; k < lastBin; k++) if (columnPower[k] > maxPower) maxPower = columnPower[k];
+
+            float db = 10.0f*log10f(maxPower/refPower + 1e-12f);
+            float level = (db - SPECTROGRAM_MIN_DB)/(-SPECTROGRAM_MIN_DB);
+            if (level < 0.0f) level = 0.0f;
+            else if (level > 1.0f) level = 1.0f;
+
+            levels[y*worker->width + x] = (unsigned char)(level*255.0f);
+        }
+    }
+
+    return true;
+}
+
+// Compute power spectrum (N/2 bins) of one windowed frames block (N frames)
+// NOTE: Real FFT computed as N/2 points complex FFT (radix-2, in-place), even frames
+// provided in re[] and odd frames in im[], both are overwritten
+static void ComputeSpectrum(SpectrogramWorker *worker, float *re, float *im, float *power)
+{
+    const int n = SPECTROGRAM_FFT_SIZE/2;
+
+    // Bit reversal permutation
+    for (int i = 1, j = 0; i < n; i++)
+    {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+        {
+            float tmp = re[i]; re[i] = re[j]; re[j] = tmp;
+            tmp = im[i]; im[i] = im[j]; im[j] = tmp;
+        }
+    }
+
+    // Butterflies, twiddle factors for every size taken from N points table
+    for (int size = 2; size <= n; size <<= 1)
+    {
+        int half = size/2;
+        int step = SPECTROGRAM_FFT_SIZE/size;
+
+        for (int i = 0; i < n; i += size)
+        {
+            for (int j = 0; j < half; j++)
+            {
+                float wr = worker->cosTable[j*step];
+                float wi = worker->sinTable[j*step];
+
+                float tr = wr*re[i + j + half] + wi*im[i + j + half];
+                float ti = wr*im[i + j + half] - wi*re[i + j + half];
+
+                re[i + j + half] = re[i + j] - tr;
+                im[i + j + half] = im[i + j] - ti;
+                re[i + j] += tr;
+                im[i + j] += ti;
+            }
+        }
+    }
+
+    // Split complex spectrum into real signal spectrum: X[k] = E[k] + W^k*O[k]
+    for (int k = 0; k < n; k++)
+    {
+        int m = (n - k)%n;
+
+        float er = 0.5f*(re[k] + re[m]);
+        float ei = 0.5f*(im[k] - im[m]);
+        float odr = 0.5f*(im[k] + im[m]);
+        float odi = -0.5f*(re[k] - re[m]);
+
+        float wr = worker->cosTable[k];
+        float wi = worker->sinTable[k];
+
+        float xr = er + wr*odr + wi*odi;
+        float xi = ei + wr*odi - wi*odr;
+
+        power[k] = xr*xr + xi*xi;
+    }
+}
+
+#if defined(SUPPORT_WAVE_WORKER)
+// Spectrogram worker thread function, waits for requests and computes latest one
+static void SpectrogramWorkerThread(void *data)
+{
+    SpectrogramWorker *worker = (SpectrogramWorker *)data;
+
+    while (true)
+    {
+        RfxSemaphoreWait(&worker->signal);
+
+        // Get latest request, several signals can be received for one request
+        RfxSemaphoreWait(&worker->lock);
+        bool quit = worker->quit;
+        bool requested = worker->requested;
+        unsigned int id = worker->requestId;
+        Wave wave = worker->wave;
+        worker->requested = false;
+        RfxSemaphorePost(&worker->lock);
+
+        if (quit) break;
+        if (!requested) continue;
+
+        unsigned char *levels = (unsigned char *)RL_CALLOC(worker->width*worker->height, 1);
+        bool computed = ComputeSpectrogram(worker, wave, id, levels);
+        UnloadWave(wave);
+
+        // Result is only kept if no newer request has been received meanwhile
+        RfxSemaphoreWait(&worker->lock);
+        if (computed && (worker->requestId == id) && !worker->quit)
+        {
+            RL_FREE(worker->levels);
+            worker->levels = levels;
+            worker->ready = true;
+        }
+        else RL_FREE(levels);
+        RfxSemaphorePost(&worker->lock);
+    }
+}
+#endif
+
+//--------------------------------------------------------------------------------------------
+// Explore grid functions
+//--------------------------------------------------------------------------------------------
+// Start explore grid candidates generation and rendering, previous candidates are unloaded
+// NOTE: Candidates parameters are generated by current thread (random numbers), rendering is
+// distributed across processors, without threads support candidates are rendered immediately
+static void StartExploreGrid(ExploreGrid *grid, int source, WaveParams params, int count)
+{
+    UnloadExploreGrid(grid);
+
+    if (count > EXPLORE_MAX_CANDIDATES) count = EXPLORE_MAX_CANDIDATES;
+
+    grid->count = count;
+    grid->threadCount = 1;
+#if defined(SUPPORT_WAVE_WORKER)
+    grid->threadCount = RfxGetProcessorCount();
+    if (grid->threadCount > RFXGEN_MAX_THREADS) grid->threadCount = RFXGEN_MAX_THREADS;
+    if (grid->threadCount > count) grid->threadCount = count;
+#endif
+    ATOMIC_STORE(&grid->cancel, 0);
+
+    for (int i = 0, thread = 0; i < count; i++)
+    {
+        ExploreCandidate *candidate = &grid->candidates[i];
+
+        candidate->params = GenSourceWaveParams(source, params);
+        candidate->generator = LoadWaveGenerator(candidate->params);
+        candidate->thread = thread;
+        thread = (thread + 1)%grid->threadCount;
+    }
+
+    for (int t = 0; t < grid->threadCount; t++)
+    {
+        grid->jobs[t].grid = grid;
+        grid->jobs[t].thread = t;
+    }
+
+#if defined(SUPPORT_WAVE_WORKER)
+    for (int t = 0; t < grid->threadCount; t++) grid->started[t] = RfxThreadCreate(&grid->threads[t], ExploreGridThread, &grid->jobs[t]);
+
+    // If a thread can not be created its candidates are rendered here
+    for (int t = 0; t < grid->threadCount; t++)
+    {
+        if (!grid->started[t]) RenderExploreCandidates(grid, t);
+    }
+#else
+    for (int t = 0; t < grid->threadCount; t++) RenderExploreCandidates(grid, t);
+#endif
+}
+
+// Update explore grid, rendered candidates peaks are loaded for drawing
+// NOTE: Returns true while candidates are rendering
+static bool UpdateExploreGrid(ExploreGrid *grid)
+{
+    bool rendering = false;
+
+    for (int i = 0; i < grid->count; i++)
+    {
+        ExploreCandidate *candidate = &grid->candidates[i];
+
+        if (!ATOMIC_LOAD(&candidate->rendered)) rendering = true;
+        else if ((candidate->peaks.levelCount == 0) && (candidate->wave.frameCount > 0)) candidate->peaks = LoadWavePeaks(candidate->wave);
+    }
+
+#if defined(SUPPORT_WAVE_WORKER)
+    // All candidates rendered, threads are finished
+    if (!rendering)
+    {
+        for (int t = 0; t < grid->threadCount; t++)
+        {
+            if (grid->started[t]) RfxThreadJoin(grid->threads[t]);
+            grid->started[t] = false;
+        }
+    }
+#endif
+
+    return rendering;
+}
+
+// Unload explore grid candidates, rendering in progress is cancelled
+static void UnloadExploreGrid(ExploreGrid *grid)
+{
+    ATOMIC_STORE(&grid->cancel, 1);
+
+#if defined(SUPPORT_WAVE_WORKER)
+    for (int t = 0; t < grid->threadCount; t++)
+    {
+        if (grid->started[t]) RfxThreadJoin(grid->threads[t]);
+        grid->started[t] = false;
+    }
+#endif
+
+    for (int i = 0; i < grid->count; i++)
+    {
+        ExploreCandidate *candidate = &grid->candidates[i];
+
+        UnloadWaveGenerator(candidate->generator);  // Not rendered candidates (cancelled)
+        UnloadWave(candidate->wave);
+        UnloadWavePeaks(candidate->peaks);
+
+        memset(candidate, 0, sizeof(ExploreCandidate));
+    }
+
+    grid->count = 0;
+}
+
+// Get explore grid candidate bounds, 4 columns up to 16 candidates, 8 columns otherwise
+static Rectangle GetExploreCandidateBounds(Rectangle bounds, int count, int index)
+{
+    int columns = (count <= 16)? 4 : 8;
+    int rows = (count + columns - 1)/columns;
+
+    float width = bounds.width/columns;
+    float height = bounds.height/rows;
+
+    return (Rectangle){ bounds.x + (index%columns)*width + 2, bounds.y + (index/columns)*height + 2, width - 4, height - 4 };
+}
+
+// Render explore grid candidates assigned to thread, checking for cancellation between blocks
+// NOTE: Rendered waves are truncated to EXPLORE_MAX_FRAMES (preview), candidates frames buffer
+// failing to allocate are rendered empty (no wave data, not played)
+static void RenderExploreCandidates(ExploreGrid *grid, int thread)
+{
+    for (int i = 0; i < grid->count; i++)
+    {
+        ExploreCandidate *candidate = &grid->candidates[i];
+
+        if (candidate->thread != thread) continue;
+        if (ATOMIC_LOAD(&grid->cancel)) break;
+
+        // Generator ownership taken
+        WaveGenerator generator = candidate->generator;
+        candidate->generator = (WaveGenerator){ 0 };
+
+        float *frames = (float *)RL_CALLOC(EXPLORE_MAX_FRAMES, sizeof(float));
+        unsigned int frameCount = 0;
+
+        while ((frames != NULL) && IsWaveGeneratorValid(generator) && (frameCount < EXPLORE_MAX_FRAMES) && !ATOMIC_LOAD(&grid->cancel))
+        {
+            unsigned int count = EXPLORE_MAX_FRAMES - frameCount;
+            if (count > WAVE_WORKER_BLOCK_FRAMES) count = WAVE_WORKER_BLOCK_FRAMES;
+
+            count = GenerateWaveFrames(&generator, frames + frameCount, count);
+            if (count == 0) break;
+
+            frameCount += count;
+        }
+
+        UnloadWaveGenerator(generator);
+
+        if (frames != NULL)
+        {
+            // Shrink frames buffer to rendered length
+            float *data = (float *)RL_REALLOC(frames, (frameCount + 1)*sizeof(float));
+            if (data != NULL) frames = data;
+
+            candidate->wave = (Wave){ frameCount, RFXGEN_GEN_SAMPLE_RATE, 32, 1, frames };
+        }
+
+        ATOMIC_STORE(&candidate->rendered, 1);
+    }
+}
+
+#if defined(SUPPORT_WAVE_WORKER)
+// Explore grid render thread function
+static void ExploreGridThread(void *data)
+{
+    ExploreJob *job = (ExploreJob *)data;
+
+    RenderExploreCandidates(job->grid, job->thread);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------
+// Wave prefetch functions
+//--------------------------------------------------------------------------------------------
+// Init wave prefetch queues, session seed taken from random generator
+// NOTE: If disabled (no wave worker thread, entries would be rendered by main thread), only seeded
+// parameters generation is used
+static void InitWavePrefetch(WavePrefetch *prefetch, bool enabled)
+{
+    memset(prefetch, 0, sizeof(WavePrefetch));
+
+    prefetch->enabled = enabled;
+    prefetch->seed = (unsigned int)GetRandomValue(1, 0x7fffffff);
+}
+
+// Generate source next wave parameters, seeded from session seed, source and entry number
+// NOTE: Mutations are also seeded, result depends on base parameters
+static WaveParams GenWavePrefetchParams(WavePrefetch *prefetch, int source, WaveParams base)
+{
+    SetRandomSeed(prefetch->seed ^ ((unsigned int)source << 24) ^ (prefetch->counter[source]*2654435761u));
+    prefetch->counter[source]++;
+
+    return GenSourceWaveParams(source, base);
+}
+
+// Check if all queues are rendered, mutations queue only if rendered from base parameters
+// NOTE: Always true if prefetching is disabled, no entries to render
+static bool IsWavePrefetchFull(WavePrefetch *prefetch, WaveParams base)
+{
+    if (!prefetch->enabled) return true;
+
+    for (int i = 0; i < WAVE_PREFETCH_SOURCES; i++)
+    {
+        if (i == 8)
+        {
+            if ((prefetch->count[i] == 0) || (memcmp(&prefetch->entries[i][0].base, &base, sizeof(WaveParams)) != 0)) return false;
+        }
+        else if (prefetch->count[i] < WAVE_PREFETCH_QUEUE_SIZE) return false;
+    }
+
+    return true;
+}
+
+// Request next missing entry rendering to wave worker, only one entry requested at a time
+// NOTE: Queues are filled in sources order, mutations entry rendered from outdated base are replaced
+// WARNING: Wave worker must not be generating, request would replace it
+static bool RequestWavePrefetch(WavePrefetch *prefetch, WaveWorker *worker, WaveParams base)
+{
+    if (!prefetch->enabled || prefetch->pending || IsWavePrefetchFull(prefetch, base)) return false;
+
+    // Outdated mutation entry discarded, current sound parameters changed
+    if ((prefetch->count[8] > 0) && (memcmp(&prefetch->entries[8][0].base, &base, sizeof(WaveParams)) != 0))
+    {
+        UnloadWave(prefetch->entries[8][0].wave);
+        UnloadWavePeaks(prefetch->entries[8][0].peaks);
+        prefetch->count[8] = 0;
+    }
+
+    for (int i = 0; i < WAVE_PREFETCH_SOURCES; i++)
+    {
+        if (prefetch->count[i] < ((i == 8)? 1 : WAVE_PREFETCH_QUEUE_SIZE))
+        {
+            prefetch->pendingSource = i;
+            prefetch->pendingParams = GenWavePrefetchParams(prefetch, i, base);
+            prefetch->pendingBase = base;
+            prefetch->pending = true;
+
+            RequestWaveWorker(worker, prefetch->pendingParams, WAVE_PREFETCH_SLOT, false);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Cancel requested entry, entry seed is reused by next entry generated for same source
+static void CancelWavePrefetch(WavePrefetch *prefetch, WaveWorker *worker)
+{
+    if (!prefetch->pending) return;
+
+    CancelWaveWorker(worker);
+
+    prefetch->counter[prefetch->pendingSource]--;
+    prefetch->pending = false;
+}
+
+// Store requested entry rendered wave, wave ownership is transferred
+static void StoreWavePrefetch(WavePrefetch *prefetch, Wave wave)
+{
+    int source = prefetch->pendingSource;
+
+    if (!prefetch->pending || (prefetch->count[source] >= WAVE_PREFETCH_QUEUE_SIZE))
+    {
+        UnloadWave(wave);
+        return;
+    }
+
+    WavePrefetchEntry *entry = &prefetch->entries[source][prefetch->count[source]];
+    entry->params = prefetch->pendingParams;
+    entry->base = prefetch->pendingBase;
+    entry->wave = wave;
+    entry->peaks = LoadWavePeaks(wave);
+
+    prefetch->count[source]++;
+    prefetch->pending = false;
+}
+
+// Get source next entry if rendered, entry ownership is transferred
+// NOTE: Mutations entry is only provided if rendered from provided base parameters
+static bool PopWavePrefetch(WavePrefetch *prefetch, int source, WaveParams base, WavePrefetchEntry *entry)
+{
+    if (prefetch->count[source] == 0) return false;
+    if ((source == 8) && (memcmp(&prefetch->entries[source][0].base, &base, sizeof(WaveParams)) != 0)) return false;
+
+    *entry = prefetch->entries[source][0];
+
+    prefetch->count[source]--;
+    for (int i = 0; i < prefetch->count[source]; i++) prefetch->entries[source][i] = prefetch->entries[source][i + 1];
+
+    return true;
+}
+
+// Unload wave prefetch entries, requested entry result is discarded by wave worker
+static void UnloadWavePrefetch(WavePrefetch *prefetch)
+{
+    for (int i = 0; i < WAVE_PREFETCH_SOURCES; i++)
+    {
+        for (int j = 0; j < prefetch->count[i]; j++)
+        {
+            UnloadWave(prefetch->entries[i][j].wave);
+            UnloadWavePeaks(prefetch->entries[i][j].peaks);
+        }
+
+        prefetch->count[i] = 0;
+    }
+
+    prefetch->pending = false;
+}
+
+//--------------------------------------------------------------------------------------------
+// Live voice functions
+//--------------------------------------------------------------------------------------------
+// Start live voice, looping sound generated in real time
+// NOTE: Audio stream must be stopped (or audio thread stop done), generator is replaced
+static void StartLiveVoice(LiveVoice *voice, AudioStream stream, WaveParams params)
+{
+    UnloadWaveGenerator(voice->generator);
+    voice->generator = LoadWaveGenerator(params);
+    voice->writeIndex = 0;
+    voice->readIndex = 0;
+
+    // Audio thread is allowed to generate once stop request is cleared
+    ATOMIC_STORE(&voice->stopped, 0);
+    ATOMIC_STORE(&voice->stopRequest, 0);
+
+    PlayAudioStream(stream);
+}
+
+// Push live voice parameters to queue (main thread)
+// NOTE: Returns false if queue is full, audio thread has not consumed previous parameters
+static bool PushLiveVoiceParams(LiveVoice *voice, WaveParams params)
+{
+    unsigned int write = voice->writeIndex;
+
+    if ((write - ATOMIC_LOAD(&voice->readIndex)) >= LIVE_VOICE_QUEUE_SIZE) return false;
+
+    voice->queue[write & (LIVE_VOICE_QUEUE_SIZE - 1)] = params;
+    ATOMIC_STORE(&voice->writeIndex, write + 1);
+
+    return true;
+}
+
+// Request live voice stop, silence output from next audio callback
+static void StopLiveVoice(LiveVoice *voice)
+{
+    ATOMIC_STORE(&voice->stopRequest, 1);
+}
+
+// Check if live voice stop is done by audio thread, generator is not used anymore
+static bool IsLiveVoiceStopped(LiveVoice *voice)
+{
+    return (ATOMIC_LOAD(&voice->stopped) == 1);
+}
+
+// Live voice audio stream callback (audio thread)
+// NOTE: Only latest parameters in queue are applied, sound restarts once ended (looping)
+static void LiveVoiceCallback(void *buffer, unsigned int frames)
+{
+    LiveVoice *voice = &liveVoice;
+    float *output = (float *)buffer;
+
+    if (ATOMIC_LOAD(&voice->stopRequest) == 1)
+    {
+        memset(output, 0, frames*sizeof(float));
+        ATOMIC_STORE(&voice->stopped, 1);
+        return;
+    }
+
+    // Get latest parameters from queue, previous ones are skipped
+    unsigned int read = voice->readIndex;
+    unsigned int write = ATOMIC_LOAD(&voice->writeIndex);
+
+    if (read != write)
+    {
+        WaveParams params = voice->queue[(write - 1) & (LIVE_VOICE_QUEUE_SIZE - 1)];
+        ATOMIC_STORE(&voice->readIndex, write);
+
+        UpdateWaveGenerator(&voice->generator, params);
+    }
+
+    unsigned int count = 0;
+    bool restarted = false;
+
+    while (count < frames)
+    {
+        unsigned int generated = GenerateWaveFrames(&voice->generator, output + count, frames - count);
+        count += generated;
+
+        if (count < frames)
+        {
+            // Sound without frames, silence output (avoids restarting forever)
+            if ((generated == 0) && restarted)
+            {
+                memset(output + count, 0, (frames - count)*sizeof(float));
+                break;
+            }
+
+            ResetWaveGenerator(&voice->generator);
+            restarted = true;
+        }
+    }
+}
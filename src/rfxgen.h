@@ -12,6 +12,7 @@
 *
 *   #define RFXGEN_RAND(min, max)
 *       Used to generate a random value between the given min and max integers. Defaults to rand().
+*       Used by parameters generation (presets, mutations), noise waves use generator own random state.
 *
 *   #define RFXGEN_SRAND
 *       Used to seed the random number generator. Defaults to srand().
@@ -19,6 +20,9 @@
 *   #define RFXGEN_CALLOC
 *       By default, will use calloc() for allocating memory.
 *
+*   #define RFXGEN_REALLOC
+*       By default, will use realloc() for resizing allocated memory.
+*
 *   #define RFXGEN_FREE
 *       By default, will use free() to deallocate memory.
 *
@@ -28,6 +32,57 @@
 *   #define RFXGEN_ISFILEEXTENSION
 *       Used to determine if a file has the given file extension.
 *
+*   #define RFXGEN_NO_THREADS
+*       Disable multithreading, QOA frames encoding runs sequentially on one core.
+*       Disabled by default on web platform.
+*
+*   #define RFXGEN_MAX_THREADS
+*       Max number of threads used for parallel encoding, defaults to 8.
+*
+*   #define RFXGEN_NO_MMAP
+*       Disable memory-mapped files, banks are loaded into memory with one read.
+*       Disabled by default on web platform.
+*
+*   #define BUILD_LIBTYPE_SHARED
+*       Export library functions when building rfxgen as a shared library (.dll/.so/.dylib)
+*
+*   #define USE_LIBTYPE_SHARED
+*       Import library functions when using rfxgen as a shared library (Windows .dll only)
+*
+*   LIBRARY BUILD:
+*       rfxgen_lib.c compiles this implementation as a static or shared library (librfxgen),
+*       available from CMake (BUILD_RFXGEN_LIB) and Makefile (make rfxgen_lib) targets
+*       NOTE: Library ABI is plain C; WaveParams and WaveBuffer memory layouts are part of it,
+*       RFXGEN_VERSION_MAJOR is increased on any incompatible change
+*
+*   STREAMING:
+*       Waves generated and written by blocks (LoadWaveGenerator(), OpenWaveWriter()), fixed memory usage
+*       Generator parameters and quality can be changed between blocks (UpdateWaveGenerator())
+*
+*   ADPCM:
+*       IMA-ADPCM .wav export (4 bit), blocks can be decoded independently at runtime (DecodeAdpcmBlock())
+*
+*   EMBEDDING:
+*       Export .bin data plus .h header for #embed/.incbin, or parameters code: .h (generator), .c (function)
+*
+*   LISTS:
+*       Several .rfx files loaded in parallel (LoadWaveParamsList()), errors returned per file, not logged
+*
+*   ENCODING:
+*       Quantized parameters encoding, 8/12/16 bit (EncodeWaveParams()), also as base58 text
+*
+*   BANKS:
+*       Parameters (.rfxb) or pre-rendered sounds (.rfxp) packed in one memory-mapped file, lookup by name
+*
+*   DEPENDENCIES:
+*       C standard library only, raylib is NOT required
+*       pthreads (Linux, macOS) or kernel32 (Windows) for parallel encoding, not required with RFXGEN_NO_THREADS
+*       NOTE: Wave export functions (.wav, .qoa, .raw, .h, .bin) are self-contained,
+*       so the library can be used on headless builds (no window/graphics/audio)
+*
+*
+*   VERSIONS HISTORY:
+*       6.0  (19-Oct-2026)  CHANGED: Noise random state per generator (randSeed), noise output differs from 5.0
 *
 *   DEVELOPERS:
 *       Ramon Santamaria (@raysan5): Developer, supervisor, updater and maintainer.
@@ -58,8 +113,33 @@
 #ifndef RFXGEN_H
 #define RFXGEN_H
 
-#ifndef RLAPI
-    #define RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#define RFXGEN_VERSION_MAJOR 6
+#define RFXGEN_VERSION_MINOR 0
+#define RFXGEN_VERSION_PATCH 0
+#define RFXGEN_VERSION  "6.0"
+
+// Function specifiers in case library is build/used as a shared library
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+// NOTE: visibility("default") attribute makes symbols "visible" when compiled with -fvisibility=hidden
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define RFXGENAPI __declspec(dllexport)     // Building the library as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED) && !defined(RFXGEN_IMPLEMENTATION)
+        #define RFXGENAPI __declspec(dllimport)     // Using the library as a Win32 shared library (.dll)
+    #endif
+#else
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define RFXGENAPI __attribute__((visibility("default"))) // Building as a Unix shared library (.so/.dylib)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef RFXGENAPI
+    #define RFXGENAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+#if !defined(__cplusplus)
+    #include <stdbool.h>    // Required for: bool
 #endif
 
 //----------------------------------------------------------------------------------
@@ -71,6 +151,10 @@
 
 #define RFXGEN_GEN_SAMPLE_SIZE         32       // Bit size of generated waves (32 bit -> float)
 #define RFXGEN_GEN_CHANNELS             1       // Channels for generated waves (only 1 - MONO)
+#define RFXGEN_GEN_SUPERSAMPLING        8       // Supersamples generated per frame (default quality)
+
+#define RFXGEN_PARAMS_ENCODED_MAX_SIZE 53       // Max size of encoded wave parameters: header, seed, mask and 22 values (16 bit)
+#define RFXGEN_PARAMS_TEXT_MAX_SIZE    74       // Max size of encoded wave parameters text (base58), including NULL terminator
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -123,6 +207,72 @@ typedef struct WaveParams {
 
 } WaveParams;
 
+// Wave data buffer type, used for conversion and export
+// NOTE: Same memory layout than raylib Wave, direct conversion supported
+typedef struct WaveBuffer {
+    unsigned int frameCount;    // Total number of frames (considering channels)
+    unsigned int sampleRate;    // Frequency (samples per second)
+    unsigned int sampleSize;    // Bit depth (bits per sample): 8, 16, 32 (24 not supported)
+    unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
+    void *data;                 // Buffer data pointer
+} WaveBuffer;
+
+// Wave generator, wave data is generated progressively (blocks)
+// NOTE: Generated data is 32 bit float, 1 channel, at RFXGEN_GEN_SAMPLE_RATE
+typedef struct WaveGenerator {
+    unsigned int frameCount;    // Total number of frames generated
+    unsigned int sampleRate;    // Frequency (samples per second)
+    void *state;                // Generator state (internal)
+} WaveGenerator;
+
+// Wave file streaming writer, data is encoded and written progressively
+// NOTE: File header sizes are updated on writer closing
+typedef struct WaveWriter {
+    unsigned int frameCount;    // Total number of frames written
+    unsigned int sampleRate;    // Frequency (samples per second)
+    unsigned int sampleSize;    // Bit depth (bits per sample): 8, 16, 32 (24 not supported)
+    unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
+    int fileType;               // File type: 0-WAV, 1-QOA, 2-RAW, 3-WAV (IMA-ADPCM)
+    void *file;                 // File handle (FILE *)
+    void *encoder;              // Encoder state (QOA, ADPCM)
+} WaveWriter;
+
+// Wave parameters bank, several sounds parameters packed in one file (.rfxb)
+// NOTE: Bank file is memory-mapped, params point directly into bank data
+typedef struct WaveBank {
+    unsigned int soundCount;    // Number of sounds in the bank
+    const WaveParams *params;   // Sounds parameters (packed array, sound id as index), NULL for encoded banks
+    void *data;                 // Bank file data (memory-mapped)
+    unsigned int dataSize;      // Bank file data size
+} WaveBank;
+
+// Wave data bank, several pre-rendered sounds packed in one file (.rfxp)
+// NOTE: Bank file is memory-mapped, sounds samples point directly into bank data
+typedef struct WavePcmBank {
+    unsigned int soundCount;    // Number of sounds in the bank
+    void *data;                 // Bank file data (memory-mapped)
+    unsigned int dataSize;      // Bank file data size
+} WavePcmBank;
+
+// Wave parameters file loading errors
+typedef enum {
+    RFXGEN_LOAD_SUCCESS = 0,    // File loaded successfully
+    RFXGEN_LOAD_ERROR_OPEN,     // File could not be opened
+    RFXGEN_LOAD_ERROR_READ,     // File data could not be read (truncated file)
+    RFXGEN_LOAD_ERROR_FORMAT,   // File format not valid (signature, parameters size)
+    RFXGEN_LOAD_ERROR_VERSION   // File version not supported
+} WaveParamsLoadError;
+
+// Wave parameters list, several .rfx files loaded in one call
+// NOTE: All list data is allocated in one block, params are zeroed for files failing to load
+typedef struct WaveParamsList {
+    unsigned int count;         // Number of files in the list
+    unsigned int errorCount;    // Number of files failing to load (1 with no files if directory could not be opened)
+    WaveParams *params;         // Wave parameters, one per file
+    unsigned char *errors;      // Loading error per file (WaveParamsLoadError)
+    char **fileNames;           // Files names (copied)
+} WaveParamsList;
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -132,21 +282,79 @@ extern "C" {            // Prevents name mangling of functions
 #endif
 
 // Load/Save/Export data functions
-RLAPI WaveParams LoadWaveParams(const char *fileName);                 // Load wave parameters from file
-RLAPI void SaveWaveParams(WaveParams params, const char *fileName);    // Save wave parameters to file
-RLAPI void ResetWaveParams(WaveParams *params);                        // Reset wave parameters
-RLAPI float *GenerateWave(WaveParams params, unsigned int *frameCount); // Generate wave data from parameters (32bit, mono)
+RFXGENAPI WaveParams LoadWaveParams(const char *fileName);                 // Load wave parameters from file
+RFXGENAPI void SaveWaveParams(WaveParams params, const char *fileName);    // Save wave parameters to file
+RFXGENAPI bool ExportWaveParamsCode(WaveParams params, const char *fileName); // Export wave parameters as code: .h (parameters + generator), .c (specialized function)
+RFXGENAPI void ResetWaveParams(WaveParams *params);                        // Reset wave parameters
+RFXGENAPI float *GenerateWave(WaveParams params, unsigned int *frameCount); // Generate wave data from parameters (32bit, mono)
+
+// Wave parameters list functions (several files)
+RFXGENAPI WaveParamsList LoadWaveParamsList(const char **fileNames, unsigned int count); // Load wave parameters from several .rfx files (read in parallel)
+RFXGENAPI WaveParamsList LoadWaveParamsDirectory(const char *dirPath);     // Load wave parameters from all .rfx files in directory (sorted by name)
+RFXGENAPI void UnloadWaveParamsList(WaveParamsList list);                  // Unload wave parameters list
+
+// Wave parameters encoding functions (quantized)
+RFXGENAPI unsigned int EncodeWaveParams(WaveParams params, int bits, unsigned char *data); // Encode wave parameters quantized (8, 12, 16 bits), returns bytes written
+RFXGENAPI unsigned int DecodeWaveParams(const unsigned char *data, unsigned int dataSize, WaveParams *params); // Decode wave parameters, returns bytes read, 0 if not valid
+RFXGENAPI unsigned int EncodeWaveParamsText(WaveParams params, int bits, char *text); // Encode wave parameters as text (base58), returns text length
+RFXGENAPI bool DecodeWaveParamsText(const char *text, WaveParams *params);  // Decode wave parameters from text (base58)
+
+// Wave parameters bank functions
+RFXGENAPI bool SaveWaveBank(const WaveParams *params, const char **names, unsigned int count, const char *fileName); // Save wave parameters bank file (.rfxb)
+RFXGENAPI bool SaveWaveBankEncoded(const WaveParams *params, const char **names, unsigned int count, int bits, const char *fileName); // Save wave parameters bank file (.rfxb), parameters encoded quantized
+RFXGENAPI WaveBank LoadWaveBank(const char *fileName);                    // Load wave parameters bank file (memory-mapped)
+RFXGENAPI bool IsWaveBankValid(WaveBank bank);                             // Check if wave parameters bank is valid
+RFXGENAPI int GetWaveBankSoundId(WaveBank bank, const char *name);         // Get bank sound id by name, -1 if not found
+RFXGENAPI const char *GetWaveBankSoundName(WaveBank bank, int id);         // Get bank sound name by id
+RFXGENAPI const WaveParams *GetWaveBankSound(WaveBank bank, const char *name); // Get bank sound parameters by name, NULL if not found (or encoded bank)
+RFXGENAPI WaveParams GetWaveBankSoundParams(WaveBank bank, int id);         // Get bank sound parameters by id (decoded for encoded banks)
+RFXGENAPI void UnloadWaveBank(WaveBank bank);                              // Unload wave parameters bank
+
+// Wave data bank functions (pre-rendered sounds)
+RFXGENAPI bool SaveWavePcmBank(const WaveBuffer *waves, const char **names, unsigned int count, const char *fileName); // Save wave data bank file (.rfxp)
+RFXGENAPI WavePcmBank LoadWavePcmBank(const char *fileName);              // Load wave data bank file (memory-mapped)
+RFXGENAPI bool IsWavePcmBankValid(WavePcmBank bank);                       // Check if wave data bank is valid
+RFXGENAPI int GetWavePcmBankSoundId(WavePcmBank bank, const char *name);   // Get bank sound id by name, -1 if not found
+RFXGENAPI const char *GetWavePcmBankSoundName(WavePcmBank bank, int id);   // Get bank sound name by id
+RFXGENAPI WaveBuffer GetWavePcmBankSound(WavePcmBank bank, int id);        // Get bank sound wave by id, data points into bank (read-only, not to be unloaded)
+RFXGENAPI void UnloadWavePcmBank(WavePcmBank bank);                        // Unload wave data bank
+
+// Wave streaming generator functions
+RFXGENAPI WaveGenerator LoadWaveGenerator(WaveParams params);             // Load wave generator for parameters
+RFXGENAPI bool IsWaveGeneratorValid(WaveGenerator generator);              // Check if wave generator is valid
+RFXGENAPI unsigned int GenerateWaveFrames(WaveGenerator *generator, float *frames, unsigned int frameCount); // Generate next wave frames (32bit, mono), returns frames generated
+RFXGENAPI void UpdateWaveGenerator(WaveGenerator *generator, WaveParams params); // Update wave generator parameters, generation position is kept
+RFXGENAPI void ResetWaveGenerator(WaveGenerator *generator);              // Reset wave generator, generation restarts from the beginning
+RFXGENAPI void SetWaveGeneratorQuality(WaveGenerator *generator, int supersampling); // Set wave generator supersampling: 8 (default), 4, 2, 1 (draft)
+RFXGENAPI void UnloadWaveGenerator(WaveGenerator generator);               // Unload wave generator
+
+// Wave buffer conversion and export functions
+RFXGENAPI WaveBuffer WaveBufferCopy(WaveBuffer wave);                      // Copy wave buffer to a new wave buffer
+RFXGENAPI void WaveBufferFormat(WaveBuffer *wave, int sampleRate, int sampleSize, int channels); // Convert wave buffer data to desired format
+RFXGENAPI bool ExportWaveBuffer(WaveBuffer wave, const char *fileName);    // Export wave buffer to file (.wav, .qoa, .raw, .h, .bin)
+RFXGENAPI void UnloadWaveBuffer(WaveBuffer wave);                          // Unload wave buffer data
+
+// Wave file streaming writer functions
+RFXGENAPI WaveWriter OpenWaveWriter(const char *fileName, int sampleRate, int sampleSize, int channels); // Open wave file writer (.wav, .qoa, .raw), sampleSize 4 for .wav IMA-ADPCM
+RFXGENAPI bool IsWaveWriterValid(WaveWriter writer);                       // Check if wave writer is valid
+RFXGENAPI bool WriteWaveFrames(WaveWriter *writer, const float *frames, unsigned int frameCount); // Write float frames (channels interleaved), converted to writer format
+RFXGENAPI bool CloseWaveWriter(WaveWriter *writer);                        // Close wave writer, updating file header
+
+// Wave IMA-ADPCM functions
+RFXGENAPI bool ExportWaveBufferADPCM(WaveBuffer wave, const char *fileName); // Export wave buffer as IMA-ADPCM .wav file (4 bit)
+RFXGENAPI unsigned int GetAdpcmBlockFrames(unsigned int blockAlign, unsigned int channels); // Get number of frames contained in one ADPCM block
+RFXGENAPI void DecodeAdpcmBlock(const unsigned char *block, unsigned int blockAlign, unsigned int channels, short *frames); // Decode one ADPCM block into 16 bit frames (channels interleaved)
 
 // Sound generation functions
-RLAPI WaveParams GenPickupCoin(void);      // Generate sound: Pickup/Coin
-RLAPI WaveParams GenLaserShoot(void);      // Generate sound: Laser shoot
-RLAPI WaveParams GenExplosion(void);       // Generate sound: Explosion
-RLAPI WaveParams GenPowerup(void);         // Generate sound: Powerup
-RLAPI WaveParams GenHitHurt(void);         // Generate sound: Hit/Hurt
-RLAPI WaveParams GenJump(void);            // Generate sound: Jump
-RLAPI WaveParams GenBlipSelect(void);      // Generate sound: Blip/Select
-RLAPI WaveParams GenRandomize(void);       // Generate random sound
-RLAPI void WaveMutate(WaveParams *params); // Mutate current sound
+RFXGENAPI WaveParams GenPickupCoin(void);      // Generate sound: Pickup/Coin
+RFXGENAPI WaveParams GenLaserShoot(void);      // Generate sound: Laser shoot
+RFXGENAPI WaveParams GenExplosion(void);       // Generate sound: Explosion
+RFXGENAPI WaveParams GenPowerup(void);         // Generate sound: Powerup
+RFXGENAPI WaveParams GenHitHurt(void);         // Generate sound: Hit/Hurt
+RFXGENAPI WaveParams GenJump(void);            // Generate sound: Jump
+RFXGENAPI WaveParams GenBlipSelect(void);      // Generate sound: Blip/Select
+RFXGENAPI WaveParams GenRandomize(void);       // Generate random sound
+RFXGENAPI void WaveMutate(WaveParams *params); // Mutate current sound
 
 #if defined(__cplusplus)
 }
@@ -163,11 +371,66 @@ RLAPI void WaveMutate(WaveParams *params); // Mutate current sound
 #if defined(RFXGEN_IMPLEMENTATION)
 
 // C standard library dependencies
-#include <stdlib.h>     // Required for: calloc(), free(), [srand(), rand()]
+#include <stdlib.h>     // Required for: calloc(), realloc(), free(), [srand(), rand()]
 #include <stdio.h>      // Required for: printf()
 #include <string.h>     // Required for: strcmp(), strlen(), memcpy()
-#include <math.h>       // Required for: abs(), pow(), powf()
-#include <time.h>       // Required for: time()
+#include <math.h>       // Required for: abs(), pow(), powf(), fabsf()
+
+#if defined(_WIN32)
+    #include <io.h>         // Required for: _findfirst(), _findnext(), _findclose()
+#else
+    #include <dirent.h>     // Required for: opendir(), readdir(), closedir()
+#endif
+
+#if !defined(RFXGEN_NO_THREADS) && (defined(PLATFORM_WEB) || defined(__EMSCRIPTEN__))
+    #define RFXGEN_NO_THREADS
+#endif
+
+#if !defined(RFXGEN_NO_THREADS)
+    #if defined(_WIN32)
+        #if !defined(_WINDOWS_)
+        // Threads and semaphores functions (kernel32.lib)
+        // NOTE: Declared manually to avoid including windows.h, that conflicts with raylib
+        void *__stdcall CreateThread(void *threadAttributes, size_t stackSize, unsigned long (__stdcall *startAddress)(void *), void *parameter, unsigned long creationFlags, unsigned long *threadId);
+        void *__stdcall CreateSemaphoreA(void *semaphoreAttributes, long initialCount, long maximumCount, const char *name);
+        int __stdcall ReleaseSemaphore(void *semaphore, long releaseCount, long *previousCount);
+        unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        int __stdcall CloseHandle(void *handle);
+        unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+        #endif
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+        #include <unistd.h>     // Required for: sysconf()
+    #endif
+#endif
+
+#if !defined(RFXGEN_NO_MMAP) && (defined(PLATFORM_WEB) || defined(__EMSCRIPTEN__))
+    #define RFXGEN_NO_MMAP
+#endif
+
+#if !defined(RFXGEN_NO_MMAP)
+    #if defined(_WIN32)
+        #if !defined(_WINDOWS_)
+        // Memory-mapped files functions (kernel32.lib)
+        // NOTE: Declared manually to avoid including windows.h, that conflicts with raylib
+        void *__stdcall CreateFileA(const char *fileName, unsigned long desiredAccess, unsigned long shareMode, void *securityAttributes, unsigned long creationDisposition, unsigned long flagsAndAttributes, void *templateFile);
+        unsigned long __stdcall GetFileSize(void *file, unsigned long *fileSizeHigh);
+        void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maximumSizeHigh, unsigned long maximumSizeLow, const char *name);
+        void *__stdcall MapViewOfFile(void *fileMapping, unsigned long desiredAccess, unsigned long fileOffsetHigh, unsigned long fileOffsetLow, size_t numberOfBytesToMap);
+        int __stdcall UnmapViewOfFile(const void *baseAddress);
+        int __stdcall CloseHandle(void *handle);
+        #endif
+    #else
+        #include <sys/mman.h>   // Required for: mmap(), munmap()
+        #include <sys/stat.h>   // Required for: fstat()
+        #include <fcntl.h>      // Required for: open()
+        #include <unistd.h>     // Required for: close()
+    #endif
+#endif
+
+#ifndef PI
+    #define PI 3.14159265358979323846f
+#endif
 
 #ifndef RFXGEN_SRAND
     #define RFXGEN_SRAND  srand
@@ -196,6 +459,11 @@ RLAPI void WaveMutate(WaveParams *params); // Mutate current sound
     #define RFXGEN_CALLOC calloc
 #endif
 
+// Resize previously allocated memory
+#ifndef RFXGEN_REALLOC
+    #define RFXGEN_REALLOC realloc
+#endif
+
 // Deallocate previously allocated memory
 #ifndef RFXGEN_FREE
     #define RFXGEN_FREE free
@@ -211,13 +479,161 @@ RLAPI void WaveMutate(WaveParams *params); // Mutate current sound
     #define RFXGEN_ISFILEEXTENSION(file, extension) (strcmp((file) + strlen(file) - strlen(extension), (extension)) == 0)
 #endif
 
+#define RFXGEN_MAX_GEN_BUFFER_LENGTH  10      // Max length for generated waves: 10 seconds
+
+#ifndef RFXGEN_MAX_THREADS
+    #define RFXGEN_MAX_THREADS         8      // Max threads used for parallel encoding
+#endif
+
+#define RFXGEN_BANK_ALIGN(size)      (((size) + 15) & ~15u)   // Banks sections alignment: 16 bytes
+#define RFXGEN_PCM_BANK_ALIGN(size)  (((size) + 63) & ~63u)   // PCM bank samples data alignment: 64 bytes
+
+#define RFXGEN_PARAMS_VALUE_COUNT       22        // Wave parameters float values, from attackTimeValue
+#define RFXGEN_PARAMS_FILE_SIZE        104        // Wave parameters file size (.rfx): header (8 bytes) + WaveParams
+#define RFXGEN_LIST_MIN_THREAD_FILES    64        // Wave parameters list min files per loading thread
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if !defined(RFXGEN_NO_THREADS)
+// Thread handle, used to run CPU-intensive processes in parallel
+#if defined(_WIN32)
+typedef void *RfxThread;
+#else
+typedef pthread_t RfxThread;
+#endif
+
+// Counting semaphore, used to synchronize threads
+#if defined(_WIN32)
+typedef void *RfxSemaphore;
+#else
+typedef struct RfxSemaphore {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int count;
+} RfxSemaphore;
+#endif
+#endif
+
+// Wave generator state, carried between generated blocks
+typedef struct WaveGeneratorState {
+    WaveParams params;              // Generation parameters (validated)
+    bool generatingSample;          // Generation not finished
+    int supersampling;              // Supersamples generated per frame (8 by default, lower for draft)
+
+    // Configuration parameters for generation
+    // NOTE: Those parameters are calculated from selected values
+    int phase;
+    double fperiod;
+    double fmaxperiod;
+    double fslide;
+    double fdslide;
+    int period;
+    float squareDuty;
+    float squareSlide;
+    int envelopeStage;
+    int envelopeTime;
+    int envelopeLength[3];
+    float envelopeVolume;
+    float fphase;
+    float fdphase;
+    int iphase;
+    float phaserBuffer[1024];
+    int ipp;
+    float noiseBuffer[32];          // Required for noise wave, depends on random seed!
+    unsigned int randState;         // Noise random state, initialized with random seed (own state per generator)
+    float fltp;
+    float fltdp;
+    float fltw;
+    float fltwd;
+    float fltdmp;
+    float fltphp;
+    float flthp;
+    float flthpd;
+    float vibratoPhase;
+    float vibratoSpeed;
+    float vibratoAmplitude;
+    int repeatTime;
+    int repeatLimit;
+    int arpeggioTime;
+    int arpeggioLimit;
+    double arpeggioModulation;
+} WaveGeneratorState;
+
+// IMA-ADPCM channel state, predicted sample and step index
+typedef struct AdpcmChannel {
+    int predictor;                  // Predicted sample value (16 bit range)
+    int index;                      // Step table index [0..88]
+} AdpcmChannel;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void ResetWaveGeneratorState(WaveGeneratorState *state, bool restart); // Reset wave generator state from parameters (restart: sound repeat)
+static float GenerateWaveSample(WaveGeneratorState *state);                 // Generate next wave sample using generator state
+static float GetWaveGeneratorRandom(WaveGeneratorState *state, float range); // Get random value [0..range] from generator random state
+
+static float GetWaveBufferSample(WaveBuffer wave, unsigned int frame, unsigned int channel, unsigned int outChannels); // Get frame sample as float, mixing channels if required
+static void SetSampleValue(void *data, int sampleSize, unsigned int index, float value); // Set sample value from float into buffer, converting to sample size
+
+static bool ExportWaveBufferWAV(WaveBuffer wave, const char *fileName);   // Export wave buffer as .wav file (PCM or IEEE float)
+static bool ExportWaveBufferQOA(WaveBuffer wave, const char *fileName);   // Export wave buffer as .qoa file (16 bit samples)
+static bool ExportWaveBufferRAW(WaveBuffer wave, const char *fileName);   // Export wave buffer as .raw file (samples data only)
+static bool ExportWaveBufferCode(WaveBuffer wave, const char *fileName);  // Export wave buffer as .h code file (samples array)
+static bool ExportWaveBufferEmbed(WaveBuffer wave, const char *fileName); // Export wave buffer as .bin data file and .h embedding header
+static void SetCodeVarName(char *varName, const char *fileName);          // Set code variable name from file name (uppercase, no extension)
+static void WriteSynthCode(FILE *codeFile);                               // Write minimal generator code (dependency-free copy of wave generator)
+static bool ExportWaveParamsFunction(WaveParams params, const char *fileName); // Export wave parameters as .c code file with a specialized generation function
+static const char *TextCodeValue(double value, bool isFloat);             // Get number as code literal text (exact value)
+
+static void SetWavHeader(unsigned char *header, unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int dataSize); // Set .wav file header (44 bytes)
+static void *LoadQoaEncoder(unsigned int sampleRate, unsigned int channels);         // Load QOA streaming encoder
+static bool QoaEncoderWrite(void *encoder, FILE *file, const float *frames, unsigned int frameCount); // Encode float frames, full QOA frames are written to file
+static bool QoaEncoderFlush(void *encoder, FILE *file);                             // Encode and write pending samples as last frame
+static void UnloadQoaEncoder(void *encoder);                                        // Unload QOA streaming encoder
+
+static int AdpcmExpandNibble(AdpcmChannel *channel, int nibble);                    // Decode one ADPCM nibble, updating channel state
+static void *LoadAdpcmEncoder(unsigned int sampleRate, unsigned int channels);       // Load IMA-ADPCM streaming encoder
+static bool AdpcmEncoderWrite(void *encoder, FILE *file, const float *frames, unsigned int frameCount); // Encode float frames, full blocks are written to file
+static bool AdpcmEncoderFlush(void *encoder, FILE *file);                           // Encode and write pending samples as last block (zero padded)
+static void SetWavAdpcmHeader(unsigned char *header, const void *encoder, unsigned int frameCount); // Set IMA-ADPCM .wav file header (60 bytes)
+static void UnloadAdpcmEncoder(void *encoder);                                      // Unload IMA-ADPCM streaming encoder
+
+static void WriteU16LE(unsigned char *bytes, unsigned short value);                 // Write little-endian 16 bit value into bytes array
+static void WriteU32LE(unsigned char *bytes, unsigned int value);                   // Write little-endian 32 bit value into bytes array
+static unsigned int ReadU32LE(const unsigned char *bytes);                          // Read little-endian 32 bit value from bytes array
+static unsigned int RfxHashName(const char *name);                                  // Get name hash (FNV-1a, 32 bit)
+static unsigned char *LoadBankData(const char *signature, unsigned int entrySize, const char **names, unsigned int count, unsigned int extraSize, unsigned int *entriesOffset, unsigned int *dataSize); // Load bank data with header, hash table and names
+static bool SaveBankData(const unsigned char *data, unsigned int dataSize, const char *fileName); // Save bank data to file
+static bool IsBankDataValid(const unsigned char *data, unsigned int dataSize, const char *signature, unsigned int entrySize); // Check bank data header and sections bounds
+static int GetBankSoundId(const unsigned char *data, const char *name);              // Get bank sound id by name (hash table lookup), -1 if not found
+static const char *GetBankSoundName(const unsigned char *data, int id);              // Get bank sound name by id
+static void *RfxMapFile(const char *fileName, unsigned int *dataSize);              // Map file data into memory (read-only)
+static void RfxUnmapFile(void *data, unsigned int dataSize);                        // Unmap file data
+
+static int LoadWaveParamsFile(const char *fileName, WaveParams *params);              // Load wave parameters from .rfx file with one read, returns WaveParamsLoadError
+static void LoadWaveParamsJobs(void *data);                                         // Load wave parameters files range (thread function)
+static int RfxCompareFiles(const void *a, const void *b);                           // Compare files paths, used to sort directory files
+static char **RfxLoadDirectoryFiles(const char *dirPath, const char *extension, unsigned int *count); // Load directory files paths with extension (not recursive)
+static void RfxUnloadDirectoryFiles(char **files, unsigned int count);              // Unload directory files paths
+
+static int RfxGetProcessorCount(void);                                              // Get number of logical processors available
+#if !defined(RFXGEN_NO_THREADS)
+static bool RfxThreadCreate(RfxThread *thread, void (*func)(void *), void *arg);     // Create thread running func(arg)
+static void RfxThreadJoin(RfxThread thread);                                        // Wait for thread to finish
+static inline void RfxSemaphoreInit(RfxSemaphore *semaphore, int count);            // Init semaphore with initial count
+static inline void RfxSemaphorePost(RfxSemaphore *semaphore);                       // Increment semaphore count
+static inline void RfxSemaphoreWait(RfxSemaphore *semaphore);                       // Wait until count > 0 and decrement it
+static inline void RfxSemaphoreUnload(RfxSemaphore *semaphore);                     // Unload semaphore
+#endif
+
 
 //--------------------------------------------------------------------------------------------
 // Load/Save/Export functions
 //--------------------------------------------------------------------------------------------
 
 // Reset wave parameters
-RLAPI void ResetWaveParams(WaveParams *params)
+RFXGENAPI void ResetWaveParams(WaveParams *params)
 {
     // NOTE: Random seed is set to a random value
     params->randSeed = RFXGEN_RAND(0x1, 0xFFFE);
@@ -266,339 +682,231 @@ RLAPI void ResetWaveParams(WaveParams *params)
 
 // Generates new wave from wave parameters
 // NOTE: By default wave is generated as 44100Hz, 32bit float, mono
-RLAPI float *GenerateWave(WaveParams params, unsigned int *frameCount)
+RFXGENAPI float *GenerateWave(WaveParams params, unsigned int *frameCount)
 {
-    #define RFXGEN_MAX_GEN_BUFFER_LENGTH  10      // Max length for generation buffer: 10 seconds
-
-    if (params.randSeed != 0) RFXGEN_SRAND(params.randSeed);   // Initialize seed if required
-
-    // Configuration parameters for generation
-    // NOTE: Those parameters are calculated from selected values
-    int phase = 0;
-    double fperiod = 0.0;
-    double fmaxperiod = 0.0;
-    double fslide = 0.0;
-    double fdslide = 0.0;
-    int period = 0;
-    float squareDuty = 0.0f;
-    float squareSlide = 0.0f;
-    int envelopeStage = 0;
-    int envelopeTime = 0;
-    int envelopeLength[3] = { 0 };
-    float envelopeVolume = 0.0f;
-    float fphase = 0.0f;
-    float fdphase = 0.0f;
-    int iphase = 0;
-    float phaserBuffer[1024] = { 0 };
-    int ipp = 0;
-    float noiseBuffer[32] = { 0 };       // Required for noise wave, depends on random seed!
-    float fltp = 0.0f;
-    float fltdp = 0.0f;
-    float fltw = 0.0f;
-    float fltwd = 0.0f;
-    float fltdmp = 0.0f;
-    float fltphp = 0.0f;
-    float flthp = 0.0f;
-    float flthpd = 0.0f;
-    float vibratoPhase = 0.0f;
-    float vibratoSpeed = 0.0f;
-    float vibratoAmplitude = 0.0f;
-    int repeatTime = 0;
-    int repeatLimit = 0;
-    int arpeggioTime = 0;
-    int arpeggioLimit = 0;
-    double arpeggioModulation = 0.0;
-
-    // HACK: Security check to avoid crash (why?)
-    if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
-    if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
-
-    // Reset sample parameters
-    //----------------------------------------------------------------------------------------
-    fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
-    period = (int)fperiod;
-    fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
-    fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
-    fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
-    squareDuty = 0.5f - params.squareDutyValue*0.5f;
-    squareSlide = -params.dutySweepValue*0.00005f;
-
-    if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
-    else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
-
-    arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
-
-    if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
-
-    // Reset filter parameters
-    fltw = powf(params.lpfCutoffValue, 3.0f)*0.1f;
-    fltwd = 1.0f + params.lpfCutoffSweepValue*0.0001f;
-    fltdmp = 5.0f/(1.0f + powf(params.lpfResonanceValue, 2.0f)*20.0f)*(0.01f + fltw);
-    if (fltdmp > 0.8f) fltdmp = 0.8f;
-    flthp = powf(params.hpfCutoffValue, 2.0f)*0.1f;
-    flthpd = 1.0f + params.hpfCutoffSweepValue*0.0003f;
-
-    // Reset vibrato
-    vibratoSpeed = powf(params.vibratoSpeedValue, 2.0f)*0.01f;
-    vibratoAmplitude = params.vibratoDepthValue*0.5f;
+    *frameCount = 0;
 
-    // Reset envelope
-    envelopeLength[0] = (int)(params.attackTimeValue*params.attackTimeValue*100000.0f);
-    envelopeLength[1] = (int)(params.sustainTimeValue*params.sustainTimeValue*100000.0f);
-    envelopeLength[2] = (int)(params.decayTimeValue*params.decayTimeValue*100000.0f);
-
-    fphase = powf(params.phaserOffsetValue, 2.0f)*1020.0f;
-    if (params.phaserOffsetValue < 0.0f) fphase = -fphase;
-
-    fdphase = powf(params.phaserSweepValue, 2.0f)*1.0f;
-    if (params.phaserSweepValue < 0.0f) fdphase = -fdphase;
-
-    iphase = abs((int)fphase);
-
-    for (int i = 0; i < 32; i++) noiseBuffer[i] = RFXGEN_RANDF(2.0f) - 1.0f;
-
-    repeatLimit = (int)(powf(1.0f - params.repeatSpeedValue, 2.0f)*20000 + 32);
-
-    if (params.repeatSpeedValue == 0.0f) repeatLimit = 0;
-    //----------------------------------------------------------------------------------------
+    WaveGenerator generator = LoadWaveGenerator(params);
+    if (!IsWaveGeneratorValid(generator)) return NULL;
 
-    // NOTE: We reserve enough space for up to 10 seconds of wave audio at given sample rate
-    // By default we use float size samples, they are converted to desired sample size at the end
-    float *buffer = (float *)RFXGEN_CALLOC(RFXGEN_MAX_GEN_BUFFER_LENGTH*RFXGEN_GEN_SAMPLE_RATE, sizeof(float));
-    bool generatingSample = true;
-    int sampleCount = 0;
+    // NOTE: Wave length is unknown until generation ends, buffer grows as required (up to 10 seconds)
+    // and it is trimmed to the generated length at the end
+    unsigned int capacity = RFXGEN_GEN_SAMPLE_RATE;
+    float *buffer = (float *)RFXGEN_CALLOC(capacity, sizeof(float));
+    unsigned int framesGenerated = 0;
 
-    for (int i = 0; i < RFXGEN_MAX_GEN_BUFFER_LENGTH*RFXGEN_GEN_SAMPLE_RATE; i++)
+    while (buffer != NULL)
     {
-        if (!generatingSample)
+        if (generator.frameCount == capacity)
         {
-            sampleCount = i;
-            break;
-        }
-
-        // Generate sample using selected parameters
-        //------------------------------------------------------------------------------------
-        repeatTime++;
-
-        if ((repeatLimit != 0) && (repeatTime >= repeatLimit))
-        {
-            // Reset sample parameters (only some of them)
-            repeatTime = 0;
-
-            fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
-            period = (int)fperiod;
-            fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
-            fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
-            fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
-            squareDuty = 0.5f - params.squareDutyValue*0.5f;
-            squareSlide = -params.dutySweepValue*0.00005f;
-
-            if (params.changeAmountValue >= 0.0f) arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
-            else arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
-
-            arpeggioTime = 0;
-            arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
-
-            if (params.changeSpeedValue == 1.0f) arpeggioLimit = 0;     // WATCH OUT: float comparison
-        }
+            float *grown = (float *)RFXGEN_REALLOC(buffer, capacity*2*sizeof(float));
 
-        // Frequency envelopes/arpeggios
-        arpeggioTime++;
+            if (grown == NULL)
+            {
+                RFXGEN_FREE(buffer);
+                buffer = NULL;
+                break;
+            }
 
-        if ((arpeggioLimit != 0) && (arpeggioTime >= arpeggioLimit))
-        {
-            arpeggioLimit = 0;
-            fperiod *= arpeggioModulation;
+            buffer = grown;
+            capacity *= 2;
         }
 
-        fslide += fdslide;
-        fperiod *= fslide;
+        framesGenerated = GenerateWaveFrames(&generator, buffer + generator.frameCount, capacity - generator.frameCount);
 
-        if (fperiod > fmaxperiod)
-        {
-            fperiod = fmaxperiod;
-
-            if (params.minFrequencyValue > 0.0f) generatingSample = false;
-        }
+        if (framesGenerated == 0) break;
+    }
 
-        float rfperiod = (float)fperiod;
+    // NOTE: Wave data is generated by default as 32bit float data and 1 channel (mono),
+    // it can be converted to desired format after generation
+    if ((buffer != NULL) && (generator.frameCount > 0) && (generator.frameCount < capacity))
+    {
+        // NOTE: If shrinking fails original buffer is still valid, just larger than required
+        float *trimmed = (float *)RFXGEN_REALLOC(buffer, generator.frameCount*sizeof(float));
+        if (trimmed != NULL) buffer = trimmed;
+    }
 
-        if (vibratoAmplitude > 0.0f)
-        {
-            vibratoPhase += vibratoSpeed;
-            rfperiod = (float)(fperiod*(1.0 + sinf(vibratoPhase)*vibratoAmplitude));
-        }
+    if (buffer != NULL) *frameCount = generator.frameCount;
 
-        period = (int)rfperiod;
+    UnloadWaveGenerator(generator);
 
-        if (period < 8) period=8;
+    return buffer;
+}
 
-        squareDuty += squareSlide;
+// Load wave generator for provided parameters
+// NOTE: Every generator keeps its own random state initialized with random seed (noise waves),
+// generators can be interleaved or run on different threads, random seed 0 is not a seed,
+// random state is taken from RFXGEN_RAND() (noise differs on every loading)
+RFXGENAPI WaveGenerator LoadWaveGenerator(WaveParams params)
+{
+    WaveGenerator generator = { 0 };
 
-        if (squareDuty < 0.0f) squareDuty = 0.0f;
-        if (squareDuty > 0.5f) squareDuty = 0.5f;
+    WaveGeneratorState *state = (WaveGeneratorState *)RFXGEN_CALLOC(1, sizeof(WaveGeneratorState));
 
-        // Volume envelope
-        envelopeTime++;
+    if (state != NULL)
+    {
+        // Initialize generator random state
+        state->randState = (params.randSeed != 0)? (unsigned int)params.randSeed : (unsigned int)RFXGEN_RAND(0, 0xFFFE);
 
-        if (envelopeTime > envelopeLength[envelopeStage])
-        {
-            envelopeTime = 0;
-            envelopeStage++;
+        // HACK: Security check to avoid crash (why?)
+        if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
+        if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
 
-            if (envelopeStage == 3) generatingSample = false;
-        }
+        state->params = params;
+        state->supersampling = RFXGEN_GEN_SUPERSAMPLING;
+        ResetWaveGeneratorState(state, false);
 
-        if (envelopeStage == 0) envelopeVolume = (float)envelopeTime/envelopeLength[0];
-        if (envelopeStage == 1) envelopeVolume = 1.0f + powf(1.0f - (float)envelopeTime/envelopeLength[1], 1.0f)*2.0f*params.sustainPunchValue;
-        if (envelopeStage == 2) envelopeVolume = 1.0f - (float)envelopeTime/envelopeLength[2];
+        generator.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+        generator.state = state;
+    }
 
-        // Phaser step
-        fphase += fdphase;
-        iphase = abs((int)fphase);
+    return generator;
+}
 
-        if (iphase > 1023) iphase = 1023;
+// Check if wave generator is valid
+RFXGENAPI bool IsWaveGeneratorValid(WaveGenerator generator)
+{
+    return (generator.state != NULL);
+}
 
-        if (flthpd != 0.0f)     // WATCH OUT!
-        {
-            flthp *= flthpd;
-            if (flthp < 0.00001f) flthp = 0.00001f;
-            if (flthp > 0.1f) flthp = 0.1f;
-        }
+// Generate next wave frames (32bit float, mono)
+// NOTE: Returns number of frames generated, lower than requested when wave ends (0 once ended)
+RFXGENAPI unsigned int GenerateWaveFrames(WaveGenerator *generator, float *frames, unsigned int frameCount)
+{
+    WaveGeneratorState *state = (WaveGeneratorState *)generator->state;
+    unsigned int framesGenerated = 0;
 
-        float ssample = 0.0f;
+    if (state == NULL) return 0;
 
-        #define MAX_SUPERSAMPLING   8
+    while ((framesGenerated < frameCount) && state->generatingSample &&
+           (generator->frameCount < RFXGEN_MAX_GEN_BUFFER_LENGTH*RFXGEN_GEN_SAMPLE_RATE))
+    {
+        frames[framesGenerated] = GenerateWaveSample(state);
+        framesGenerated++;
+        generator->frameCount++;
+    }
 
-        // Supersampling x8
-        for (int si = 0; si < MAX_SUPERSAMPLING; si++)
-        {
-            float sample = 0.0f;
-            phase++;
+    return framesGenerated;
+}
 
-            if (phase >= period)
-            {
-                //phase = 0;
-                phase %= period;
+// Update wave generator parameters, generation position is kept (envelope, phase, filters)
+// NOTE: Parameters are applied from next generated frame, values changing over time
+// (frequency, duty, filters cutoff, phaser offset) are only reset if their parameter changed
+// WARNING: Same derived values than ResetWaveGeneratorState(), both must be kept in sync
+RFXGENAPI void UpdateWaveGenerator(WaveGenerator *generator, WaveParams params)
+{
+    WaveGeneratorState *state = (WaveGeneratorState *)generator->state;
 
-                if (params.waveTypeValue == 3)
-                {
-                    for (int i = 0;i < 32; i++) noiseBuffer[i] = RFXGEN_RANDF(2.0f) - 1.0f;
-                }
-            }
+    if (state == NULL) return;
 
-            // base waveform
-            float fp = (float)phase/period;
+    // HACK: Same security check than LoadWaveGenerator()
+    if (params.minFrequencyValue > params.startFrequencyValue) params.minFrequencyValue = params.startFrequencyValue;
+    if (params.slideValue < params.deltaSlideValue) params.slideValue = params.deltaSlideValue;
 
-            switch (params.waveTypeValue)
-            {
-                case 0: // Square wave
-                {
-                    if (fp < squareDuty) sample = 0.5f;
-                    else sample = -0.5f;
-
-                } break;
-                case 1: sample = 1.0f - fp*2; break;    // Sawtooth wave
-                case 2: sample = sinf(fp*2*PI); break;  // Sine wave
-                case 3: sample = noiseBuffer[phase*32/period]; break; // Noise wave
-                default: break;
-            }
+    WaveParams prev = state->params;
+    state->params = params;
 
-            // LP filter
-            float pp = fltp;
-            fltw *= fltwd;
+    // Update frequency and duty
+    if (params.startFrequencyValue != prev.startFrequencyValue) state->fperiod = 100.0/(params.startFrequencyValue*params.startFrequencyValue + 0.001);
+    state->fmaxperiod = 100.0/(params.minFrequencyValue*params.minFrequencyValue + 0.001);
+    if (params.slideValue != prev.slideValue) state->fslide = 1.0 - pow((double)params.slideValue, 3.0)*0.01;
+    state->fdslide = -pow((double)params.deltaSlideValue, 3.0)*0.000001;
+    if (params.squareDutyValue != prev.squareDutyValue) state->squareDuty = 0.5f - params.squareDutyValue*0.5f;
+    state->squareSlide = -params.dutySweepValue*0.00005f;
 
-            if (fltw < 0.0f) fltw = 0.0f;
-            if (fltw > 0.1f) fltw = 0.1f;
+    // Update arpeggio
+    if (params.changeAmountValue >= 0.0f) state->arpeggioModulation = 1.0 - pow((double)params.changeAmountValue, 2.0)*0.9;
+    else state->arpeggioModulation = 1.0 + pow((double)params.changeAmountValue, 2.0)*10.0;
 
-            if (params.lpfCutoffValue != 1.0f)  // WATCH OUT!
-            {
-                fltdp += (sample-fltp)*fltw;
-                fltdp -= fltdp*fltdmp;
-            }
-            else
-            {
-                fltp = sample;
-                fltdp = 0.0f;
-            }
+    if (params.changeSpeedValue != prev.changeSpeedValue)
+    {
+        state->arpeggioLimit = (int)(powf(1.0f - params.changeSpeedValue, 2.0f)*20000 + 32);
+        if (params.changeSpeedValue == 1.0f) state->arpeggioLimit = 0;     // WATCH OUT: float comparison
+    }
 
-            fltp += fltdp;
+    // Update filters
+    if (params.lpfCutoffValue != prev.lpfCutoffValue) state->fltw = powf(params.lpfCutoffValue, 3.0f)*0.1f;
+    state->fltwd = 1.0f + params.lpfCutoffSweepValue*0.0001f;
+    state->fltdmp = 5.0f/(1.0f + powf(params.lpfResonanceValue, 2.0f)*20.0f)*(0.01f + powf(params.lpfCutoffValue, 3.0f)*0.1f);
+    if (state->fltdmp > 0.8f) state->fltdmp = 0.8f;
+    if (params.hpfCutoffValue != prev.hpfCutoffValue) state->flthp = powf(params.hpfCutoffValue, 2.0f)*0.1f;
+    state->flthpd = 1.0f + params.hpfCutoffSweepValue*0.0003f;
+
+    // Update vibrato
+    state->vibratoSpeed = powf(params.vibratoSpeedValue, 2.0f)*0.01f;
+    state->vibratoAmplitude = params.vibratoDepthValue*0.5f;
+
+    // Update envelope, current stage time is kept
+    state->envelopeLength[0] = (int)(params.attackTimeValue*params.attackTimeValue*100000.0f);
+    state->envelopeLength[1] = (int)(params.sustainTimeValue*params.sustainTimeValue*100000.0f);
+    state->envelopeLength[2] = (int)(params.decayTimeValue*params.decayTimeValue*100000.0f);
+
+    // Update phaser
+    if (params.phaserOffsetValue != prev.phaserOffsetValue)
+    {
+        state->fphase = powf(params.phaserOffsetValue, 2.0f)*1020.0f;
+        if (params.phaserOffsetValue < 0.0f) state->fphase = -state->fphase;
+    }
 
-            // HP filter
-            fltphp += fltp - pp;
-            fltphp -= fltphp*flthp;
-            sample = fltphp;
+    state->fdphase = powf(params.phaserSweepValue, 2.0f)*1.0f;
+    if (params.phaserSweepValue < 0.0f) state->fdphase = -state->fdphase;
 
-            // Phaser
-            phaserBuffer[ipp & 1023] = sample;
-            sample += phaserBuffer[(ipp - iphase + 1024) & 1023];
-            ipp = (ipp + 1) & 1023;
+    // Update repeat
+    state->repeatLimit = (int)(powf(1.0f - params.repeatSpeedValue, 2.0f)*20000 + 32);
+    if (params.repeatSpeedValue == 0.0f) state->repeatLimit = 0;
+}
 
-            // Final accumulation and envelope application
-            ssample += sample*envelopeVolume;
-        }
+// Reset wave generator, generation restarts from the beginning
+// NOTE: Random state is not initialized again (noise waves differ between restarts), no allocations
+RFXGENAPI void ResetWaveGenerator(WaveGenerator *generator)
+{
+    WaveGeneratorState *state = (WaveGeneratorState *)generator->state;
 
-        #define SAMPLE_SCALE_COEFICIENT 0.2f    // NOTE: Used to scale sample value to [-1..1]
+    if (state == NULL) return;
 
-        ssample = (ssample/MAX_SUPERSAMPLING)*SAMPLE_SCALE_COEFICIENT;
-        //------------------------------------------------------------------------------------
+    WaveParams params = state->params;
+    int supersampling = state->supersampling;
+    unsigned int randState = state->randState;
+    WaveGeneratorState reset = { 0 };
+    *state = reset;
+    state->params = params;
+    state->supersampling = supersampling;
+    state->randState = randState;
 
-        // Accumulate samples in the buffer
-        if (ssample > 1.0f) ssample = 1.0f;
-        if (ssample < -1.0f) ssample = -1.0f;
+    ResetWaveGeneratorState(state, false);
+    generator->frameCount = 0;
+}
 
-        buffer[i] = ssample;
-    }
+// Set wave generator supersampling: 8 (default), 4, 2, 1 (draft)
+// NOTE: Oscillator phase, filters sweep and phaser advance several supersamples per step on lower
+// values, wave keeps pitch and length, filters response and aliasing differ (draft quality)
+RFXGENAPI void SetWaveGeneratorQuality(WaveGenerator *generator, int supersampling)
+{
+    WaveGeneratorState *state = (WaveGeneratorState *)generator->state;
 
-    // NOTE: Wave data is generated by default as 32bit float data and 1 channel (mono)
+    if (state == NULL) return;
 
-    float *genWaveData = (float *)RFXGEN_CALLOC(sampleCount, sizeof(float));
-    RFXGEN_MEMCPY(genWaveData, buffer, sampleCount*sizeof(float));
-    RFXGEN_FREE(buffer);
-    
-    // NOTE: Wave can be converted to desired format after generation
+    if ((supersampling == 1) || (supersampling == 2) || (supersampling == 4) || (supersampling == RFXGEN_GEN_SUPERSAMPLING)) state->supersampling = supersampling;
+    else RFXGEN_LOG("WARNING: Wave generator supersampling not supported: %i\n", supersampling);
+}
 
-    *frameCount = sampleCount;      // By default generated wave only has 1 channel
-    return genWaveData;
+// Unload wave generator
+RFXGENAPI void UnloadWaveGenerator(WaveGenerator generator)
+{
+    RFXGEN_FREE(generator.state);
 }
 
 // Load .rfx (rFXGen) or .sfs (sfxr) sound parameters file
-RLAPI WaveParams LoadWaveParams(const char *fileName)
+RFXGENAPI WaveParams LoadWaveParams(const char *fileName)
 {
     WaveParams params = { 0 };
 
     if (RFXGEN_ISFILEEXTENSION(fileName, ".rfx"))
     {
-        FILE *rfxFile = fopen(fileName, "rb");
-
-        if (rfxFile != NULL)
-        {
-            // Read .rfx file header
-            unsigned char signature[5] = { 0 };
-            fread(signature, 4, sizeof(unsigned char), rfxFile);
-
-            // Check for valid .rfx file (FormatCC)
-            if ((signature[0] == 'r') &&
-                (signature[1] == 'F') &&
-                (signature[2] == 'X') &&
-                (signature[3] == ' '))
-            {
-                unsigned short version = 0;
-                unsigned short length = 0;
-                fread(&version, 1, sizeof(unsigned short), rfxFile);
-                fread(&length, 1, sizeof(unsigned short), rfxFile);
-
-                if (version != 200) RFXGEN_LOG("[%s] rFX file version not supported (%i)\n", fileName, version);
-                else
-                {
-                    if (length != sizeof(WaveParams)) RFXGEN_LOG("[%s] Wrong rFX wave parameters size\n", fileName);
-                    else fread(&params, 1, sizeof(WaveParams), rfxFile);   // Load wave generation parameters
-                }
-            }
-            else RFXGEN_LOG("[%s] rFX file does not seem to be valid\n", fileName);
+        int error = LoadWaveParamsFile(fileName, &params);
 
-            fclose(rfxFile);
-        }
+        if (error == RFXGEN_LOAD_ERROR_VERSION) RFXGEN_LOG("[%s] rFX file version not supported\n", fileName);
+        else if ((error == RFXGEN_LOAD_ERROR_FORMAT) || (error == RFXGEN_LOAD_ERROR_READ)) RFXGEN_LOG("[%s] rFX file does not seem to be valid\n", fileName);
     }
     /*
     else if (RFXGEN_ISFILEEXTENSION(fileName, ".sfs"))
@@ -670,8 +978,105 @@ RLAPI WaveParams LoadWaveParams(const char *fileName)
     return params;
 }
 
+// Load wave parameters from several .rfx files, files are read in parallel
+// NOTE: Errors are not logged, check list.errors (one per file) when list.errorCount > 0
+RFXGENAPI WaveParamsList LoadWaveParamsList(const char **fileNames, unsigned int count)
+{
+    WaveParamsList list = { 0 };
+
+    if ((fileNames == NULL) || (count == 0)) return list;
+
+    // List data allocated in one block: params, file names pointers, errors, file names
+    unsigned int namesSize = 0;
+    for (unsigned int i = 0; i < count; i++) namesSize += (unsigned int)strlen(fileNames[i]) + 1;
+
+    unsigned char *data = (unsigned char *)RFXGEN_CALLOC(count*(sizeof(WaveParams) + sizeof(char *) + 1) + namesSize, 1);
+    if (data == NULL) return list;
+
+    list.count = count;
+    list.params = (WaveParams *)data;
+    list.fileNames = (char **)(data + count*sizeof(WaveParams));
+    list.errors = data + count*(sizeof(WaveParams) + sizeof(char *));
+
+    char *name = (char *)list.errors + count;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        list.fileNames[i] = name;
+        strcpy(name, fileNames[i]);
+        name += strlen(fileNames[i]) + 1;
+    }
+
+    // Files are distributed in ranges across threads, reading is mostly waiting for
+    // the file system so threads are not limited to processors count
+    WaveParamsList tasks[RFXGEN_MAX_THREADS] = { 0 };
+    unsigned int threadCount = count/RFXGEN_LIST_MIN_THREAD_FILES;
+
+    if (threadCount > RFXGEN_MAX_THREADS) threadCount = RFXGEN_MAX_THREADS;
+    if (threadCount == 0) threadCount = 1;
+
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        unsigned int first = count*t/threadCount;
+
+        tasks[t].count = count*(t + 1)/threadCount - first;
+        tasks[t].params = list.params + first;
+        tasks[t].errors = list.errors + first;
+        tasks[t].fileNames = list.fileNames + first;
+    }
+
+#if !defined(RFXGEN_NO_THREADS)
+    RfxThread threads[RFXGEN_MAX_THREADS] = { 0 };
+    bool started[RFXGEN_MAX_THREADS] = { 0 };
+
+    // Current thread loads first range, if a thread can not be created its range is loaded here
+    for (unsigned int t = 1; t < threadCount; t++) started[t] = RfxThreadCreate(&threads[t], LoadWaveParamsJobs, &tasks[t]);
+
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        if (!started[t]) LoadWaveParamsJobs(&tasks[t]);
+    }
+
+    for (unsigned int t = 1; t < threadCount; t++)
+    {
+        if (started[t]) RfxThreadJoin(threads[t]);
+    }
+#else
+    for (unsigned int t = 0; t < threadCount; t++) LoadWaveParamsJobs(&tasks[t]);
+#endif
+
+    for (unsigned int t = 0; t < threadCount; t++) list.errorCount += tasks[t].errorCount;
+
+    return list;
+}
+
+// Load wave parameters from all .rfx files in directory, sorted by name (not recursive)
+// NOTE: List file names include directory path, errors are not logged: if directory can
+// not be opened an empty list is returned with list.errorCount = 1
+RFXGENAPI WaveParamsList LoadWaveParamsDirectory(const char *dirPath)
+{
+    WaveParamsList list = { 0 };
+    unsigned int count = 0;
+    char **files = RfxLoadDirectoryFiles(dirPath, ".rfx", &count);
+
+    if (files != NULL)
+    {
+        list = LoadWaveParamsList((const char **)files, count);
+        RfxUnloadDirectoryFiles(files, count);
+    }
+    else list.errorCount = 1;
+
+    return list;
+}
+
+// Unload wave parameters list
+RFXGENAPI void UnloadWaveParamsList(WaveParamsList list)
+{
+    RFXGEN_FREE(list.params);
+}
+
 // Save .rfx sound parameters file
-RLAPI void SaveWaveParams(WaveParams params, const char *fileName)
+RFXGENAPI void SaveWaveParams(WaveParams params, const char *fileName)
 {
     if (RFXGEN_ISFILEEXTENSION(fileName, ".rfx"))
     {
@@ -706,306 +1111,3582 @@ RLAPI void SaveWaveParams(WaveParams params, const char *fileName)
     }
 }
 
-//--------------------------------------------------------------------------------------------
-// Sound generation functions
-//--------------------------------------------------------------------------------------------
-
-// Generate sound: Pickup/Coin
-RLAPI WaveParams GenPickupCoin(void)
+// Export wave parameters as code file
+// NOTE: Supported file formats: .h (parameters and minimal generator), .c (specialized generation function)
+// Header includes a dependency-free copy of the generator (C standard library only),
+// wave data is synthesized at first use, matching GenerateWave() output with same math library
+RFXGENAPI bool ExportWaveParamsCode(WaveParams params, const char *fileName)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    bool success = false;
 
-    params.startFrequencyValue = 0.4f + RFXGEN_RANDF(0.5f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = RFXGEN_RANDF(0.1f);
-    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.4f);
-    params.sustainPunchValue = 0.3f + RFXGEN_RANDF(0.3f);
+    if (RFXGEN_ISFILEEXTENSION(fileName, ".c")) return ExportWaveParamsFunction(params, fileName);
 
-    if (RFXGEN_RAND01)
+    // Wave is generated once to get frame count, required for data array size
+    unsigned int frameCount = 0;
+    float *data = GenerateWave(params, &frameCount);
+    RFXGEN_FREE(data);
+
+    if (frameCount == 0) return success;
+
+    char varFileName[256] = { 0 };
+    SetCodeVarName(varFileName, fileName);
+
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile != NULL)
     {
-        params.changeSpeedValue = 0.5f + RFXGEN_RANDF(0.2f);
-        params.changeAmountValue = 0.2f + RFXGEN_RANDF(0.4f);
+        const char *name = varFileName;
+        const char *valueNames[22] = {
+            "attackTime", "sustainTime", "sustainPunch", "decayTime", "startFrequency", "minFrequency",
+            "slide", "deltaSlide", "vibratoDepth", "vibratoSpeed", "changeAmount", "changeSpeed",
+            "squareDuty", "dutySweep", "repeatSpeed", "phaserOffset", "phaserSweep",
+            "lpfCutoff", "lpfCutoffSweep", "lpfResonance", "hpfCutoff", "hpfCutoffSweep"
+        };
+
+        fprintf(codeFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// WaveAsParams exporter v1.0 - Wave parameters, synthesized at first use       //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/rfxgen                        //\n");
+        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// Copyright (c) 2018-2026 raylib technologies (@raylibtech)                    //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        // Add wave information, generated data is always 32 bit float, mono
+        fprintf(codeFile, "// Wave data information\n");
+        fprintf(codeFile, "#define %s_FRAME_COUNT      %u\n", name, frameCount);
+        fprintf(codeFile, "#define %s_SAMPLE_RATE      %u\n", name, RFXGEN_GEN_SAMPLE_RATE);
+        fprintf(codeFile, "#define %s_SAMPLE_SIZE      %u\n", name, RFXGEN_GEN_SAMPLE_SIZE);
+        fprintf(codeFile, "#define %s_CHANNELS         %u\n\n", name, RFXGEN_GEN_CHANNELS);
+
+        // Add generator code, included only once by several sounds headers
+        WriteSynthCode(codeFile);
+
+        // Add wave parameters, float values written with enough digits to be exact
+        fprintf(codeFile, "\n// Wave parameters (96 bytes)\n");
+        fprintf(codeFile, "static const RfxSynthParams %s_PARAMS = {\n", name);
+        char text[32] = { 0 };
+        sprintf(text, "%i,", params.randSeed);
+        fprintf(codeFile, "    %-24s// randSeed\n", text);
+        sprintf(text, "%i,", params.waveTypeValue);
+        fprintf(codeFile, "    %-24s// waveType\n", text);
+
+        for (int i = 0; i < 22; i++)
+        {
+            sprintf(text, "%s,", TextCodeValue((&params.attackTimeValue)[i], true));
+            fprintf(codeFile, "    %-24s// %s\n", text, valueNames[i]);
+        }
+
+        fprintf(codeFile, "};\n\n");
+
+        // Add wave data array (zero-initialized, no binary size) and generation on first use
+        fprintf(codeFile, "// Wave data, generated on first %s_GetData() call\n", name);
+        fprintf(codeFile, "static float %s_DATA[%s_FRAME_COUNT];\n\n", name, name);
+        fprintf(codeFile, "// Get wave data, sound is synthesized on first call\n");
+        fprintf(codeFile, "static inline const float *%s_GetData(void)\n", name);
+        fprintf(codeFile, "{\n");
+        fprintf(codeFile, "    static int generated = 0;\n\n");
+        fprintf(codeFile, "    if (!generated)\n");
+        fprintf(codeFile, "    {\n");
+        fprintf(codeFile, "        RfxSynthGenerate(&%s_PARAMS, %s_DATA, %s_FRAME_COUNT);\n", name, name, name);
+        fprintf(codeFile, "        generated = 1;\n");
+        fprintf(codeFile, "    }\n\n");
+        fprintf(codeFile, "    return %s_DATA;\n", name);
+        fprintf(codeFile, "}\n");
+
+        success = (ferror(codeFile) == 0);
+        fclose(codeFile);
     }
 
-    return params;
+    return success;
 }
 
-// Generate sound: Laser shoot
-RLAPI WaveParams GenLaserShoot(void)
+//--------------------------------------------------------------------------------------------
+// Wave parameters encoding functions (quantized)
+//--------------------------------------------------------------------------------------------
+
+// Wave parameters values quantization ranges, from attackTimeValue
+// NOTE: Ranges cover sliders ranges and values generated by GenRandomize(),
+// negative range: values in [range..-range] (signed), positive range: values in [0..range]
+static const float paramsQuantRange[RFXGEN_PARAMS_VALUE_COUNT] = {
+    -1.0f, 2.0f, 1.0f, -2.0f,                   // Envelope: attack, sustain, punch, decay
+    -2.0f, 1.0f, -1.0f, -1.0f, -1.0f, -1.0f,    // Frequency: start, min, slide, delta slide, vibrato depth, vibrato speed
+    -1.0f, -1.0f,                               // Tone change: amount, speed
+    -1.0f, -1.0f,                               // Square wave: duty, sweep
+    -1.0f,                                      // Repeat: speed
+    -1.0f, -1.0f,                               // Phaser: offset, sweep
+    1.0f, -1.0f, -1.0f, 1.0f, -1.0f             // Filters: lpf cutoff, lpf sweep, lpf resonance, hpf cutoff, hpf sweep
+};
+
+// Encode wave parameters quantized, returns bytes written (up to RFXGEN_PARAMS_ENCODED_MAX_SIZE)
+// NOTE: Values are clamped to quantization ranges, zero and range limits are exact
+RFXGENAPI unsigned int EncodeWaveParams(WaveParams params, int bits, unsigned char *data)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    // Encoded Wave Parameters Structure
+    // ------------------------------------------------------
+    // Size   | Type       | Description
+    // ------------------------------------------------------
+    // 1      | byte       | Wave type (bits 0-1), quantization: 0-8, 1-12, 2-16 bits (bits 2-3), version: 0 (bits 4-7)
+    // 1..5   | varint     | Random seed (unsigned, 7 bits per byte, little-endian)
+    // 3      | int        | Non-zero values mask (bit per value, from attackTimeValue)
+    // N      | bitstream  | Non-zero values, bits per value, LSB first (zero padded)
+    // ------------------------------------------------------
+    // NOTE: Values with signed range are stored as signed integers (two's complement)
+    if ((data == NULL) || ((bits != 8) && (bits != 12) && (bits != 16))) return 0;
+
+    const float *values = &params.attackTimeValue;
+    unsigned int seed = (unsigned int)params.randSeed;
+    unsigned int size = 0;
+
+    data[size++] = (unsigned char)((params.waveTypeValue & 0x3) | (((bits - 8)/4) << 2));
+
+    do
+    {
+        data[size] = seed & 0x7f;
+        seed >>= 7;
+        if (seed != 0) data[size] |= 0x80;
+        size++;
+    } while (seed != 0);
 
-    params.waveTypeValue = RFXGEN_RAND(0, 2);
+    unsigned int quantValues[RFXGEN_PARAMS_VALUE_COUNT] = { 0 };
+    unsigned int mask = 0;
 
-    if ((params.waveTypeValue == 2) && RFXGEN_RAND01) params.waveTypeValue = RFXGEN_RAND01;
+    for (int i = 0; i < RFXGEN_PARAMS_VALUE_COUNT; i++)
+    {
+        float range = paramsQuantRange[i];
+        float value = values[i]/fabsf(range);
+        int quant = 0;
 
-    params.startFrequencyValue = 0.5f + RFXGEN_RANDF(0.5f);
-    params.minFrequencyValue = params.startFrequencyValue - 0.2f - RFXGEN_RANDF(0.6f);
+        if (range < 0.0f)
+        {
+            int maxQuant = (1 << (bits - 1)) - 1;
 
-    if (params.minFrequencyValue < 0.2f) params.minFrequencyValue = 0.2f;
+            if (!(value >= -1.0f)) value = -1.0f;   // NOTE: NaN also clamped
+            else if (value > 1.0f) value = 1.0f;
 
-    params.slideValue = -0.15f - RFXGEN_RANDF(0.2f);
+            quant = (int)(value*maxQuant + ((value < 0.0f)? -0.5f : 0.5f));
+        }
+        else
+        {
+            int maxQuant = (1 << bits) - 1;
 
-    if (RFXGEN_RAND(0, 2) == 0)
-    {
-        params.startFrequencyValue = 0.3f + RFXGEN_RANDF(0.6f);
-        params.minFrequencyValue = RFXGEN_RANDF(0.1f);
-        params.slideValue = -0.35f - RFXGEN_RANDF(0.3f);
-    }
+            if (!(value >= 0.0f)) value = 0.0f;
+            else if (value > 1.0f) value = 1.0f;
 
-    if (RFXGEN_RAND01)
-    {
-        params.squareDutyValue = RFXGEN_RANDF(0.5f);
-        params.dutySweepValue = RFXGEN_RANDF(0.2f);
-    }
-    else
-    {
-        params.squareDutyValue = 0.4f + RFXGEN_RANDF(0.5f);
-        params.dutySweepValue = -RFXGEN_RANDF(0.7f);
+            quant = (int)(value*maxQuant + 0.5f);
+        }
+
+        quantValues[i] = (unsigned int)quant & ((1u << bits) - 1);
+        if (quant != 0) mask |= (1u << i);
     }
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
-    params.decayTimeValue = RFXGEN_RANDF(0.4f);
+    data[size++] = mask & 0xff;
+    data[size++] = (mask >> 8) & 0xff;
+    data[size++] = (mask >> 16) & 0xff;
 
-    if (RFXGEN_RAND01) params.sustainPunchValue = RFXGEN_RANDF(0.3f);
+    unsigned int bitBuffer = 0;
+    int bitCount = 0;
 
-    if (RFXGEN_RAND(0, 2) == 0)
+    for (int i = 0; i < RFXGEN_PARAMS_VALUE_COUNT; i++)
     {
-        params.phaserOffsetValue = RFXGEN_RANDF(0.2f);
-        params.phaserSweepValue = -RFXGEN_RANDF(0.2f);
+        if (!(mask & (1u << i))) continue;
+
+        bitBuffer |= quantValues[i] << bitCount;
+        bitCount += bits;
+
+        while (bitCount >= 8)
+        {
+            data[size++] = bitBuffer & 0xff;
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
     }
 
-    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
+    if (bitCount > 0) data[size++] = bitBuffer & 0xff;
 
-    return params;
+    return size;
 }
 
-// Generate sound: Explosion
-RLAPI WaveParams GenExplosion(void)
+// Decode wave parameters, returns bytes read, 0 if data is not valid
+// NOTE: Encoded parameters are self-delimited, several can be decoded from one data stream
+RFXGENAPI unsigned int DecodeWaveParams(const unsigned char *data, unsigned int dataSize, WaveParams *params)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    if ((data == NULL) || (params == NULL) || (dataSize < 5)) return 0;
+    if ((data[0] & 0xf0) || (((data[0] >> 2) & 0x3) > 2)) return 0;     // Version or quantization not supported
 
-    params.waveTypeValue = 3;
+    int bits = 8 + ((data[0] >> 2) & 0x3)*4;
+    unsigned int seed = 0;
+    unsigned int size = 1;
 
-    if (RFXGEN_RAND01)
+    for (int shift = 0; ; shift += 7)
     {
-        params.startFrequencyValue = 0.1f + RFXGEN_RANDF(0.4f);
-        params.slideValue = -0.1f + RFXGEN_RANDF(0.4f);
+        if ((size >= dataSize) || (shift > 28)) return 0;
+
+        seed |= (unsigned int)(data[size] & 0x7f) << shift;
+        if (!(data[size++] & 0x80)) break;
     }
-    else
+
+    if ((dataSize - size) < 3) return 0;
+
+    unsigned int mask = data[size] | (data[size + 1] << 8) | (data[size + 2] << 16);
+    size += 3;
+
+    if (mask >> RFXGEN_PARAMS_VALUE_COUNT) return 0;
+
+    unsigned int valueCount = 0;
+    for (int i = 0; i < RFXGEN_PARAMS_VALUE_COUNT; i++) if (mask & (1u << i)) valueCount++;
+    if ((dataSize - size) < (valueCount*bits + 7)/8) return 0;
+
+    WaveParams decoded = { 0 };
+    float *values = &decoded.attackTimeValue;
+    unsigned int bitBuffer = 0;
+    int bitCount = 0;
+
+    decoded.randSeed = (int)seed;
+    decoded.waveTypeValue = data[0] & 0x3;
+
+    for (int i = 0; i < RFXGEN_PARAMS_VALUE_COUNT; i++)
     {
-        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.7f);
-        params.slideValue = -0.2f - RFXGEN_RANDF(0.2f);
+        if (!(mask & (1u << i))) continue;
+
+        while (bitCount < bits)
+        {
+            bitBuffer |= (unsigned int)data[size++] << bitCount;
+            bitCount += 8;
+        }
+
+        int quant = (int)(bitBuffer & ((1u << bits) - 1));
+        bitBuffer >>= bits;
+        bitCount -= bits;
+
+        float range = paramsQuantRange[i];
+
+        if (range < 0.0f)
+        {
+            int maxQuant = (1 << (bits - 1)) - 1;
+
+            if (quant & (1 << (bits - 1))) quant -= (1 << bits);
+            if (quant < -maxQuant) quant = -maxQuant;
+
+            values[i] = (float)quant/maxQuant*-range;
+        }
+        else values[i] = (float)quant/((1 << bits) - 1)*range;
     }
 
-    params.startFrequencyValue *= params.startFrequencyValue;
+    *params = decoded;
 
-    if (RFXGEN_RAND(0, 4) == 0) params.slideValue = 0.0f;
-    if (RFXGEN_RAND(0, 2) == 0) params.repeatSpeedValue = 0.3f + RFXGEN_RANDF(0.5f);
+    return size;
+}
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.3f);
-    params.decayTimeValue = RFXGEN_RANDF(0.5f);
+// Encode wave parameters as text (base58), returns text length
+// NOTE: Text buffer must be at least RFXGEN_PARAMS_TEXT_MAX_SIZE bytes, no ambiguous characters (0, O, I, l)
+RFXGENAPI unsigned int EncodeWaveParamsText(WaveParams params, int bits, char *text)
+{
+    static const char *alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
-    if (RFXGEN_RAND01 == 0)
+    unsigned char data[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };
+    unsigned char digits[RFXGEN_PARAMS_TEXT_MAX_SIZE] = { 0 };     // Base58 digits, little-endian
+    unsigned int digitCount = 0;
+    unsigned int length = 0;
+
+    if (text == NULL) return 0;
+    text[0] = '\0';
+
+    unsigned int size = EncodeWaveParams(params, bits, data);
+    if (size == 0) return 0;
+
+    // Leading zero bytes are encoded as '1'
+    while ((length < size) && (data[length] == 0)) text[length++] = alphabet[0];
+
+    for (unsigned int i = length; i < size; i++)
     {
-        params.phaserOffsetValue = -0.3f + RFXGEN_RANDF(0.9f);
-        params.phaserSweepValue = -RFXGEN_RANDF(0.3f);
+        unsigned int carry = data[i];
+
+        for (unsigned int j = 0; j < digitCount; j++)
+        {
+            carry += (unsigned int)digits[j] << 8;
+            digits[j] = carry%58;
+            carry /= 58;
+        }
+
+        while (carry > 0)
+        {
+            digits[digitCount++] = carry%58;
+            carry /= 58;
+        }
     }
 
-    params.sustainPunchValue = 0.2f + RFXGEN_RANDF(0.6f);
+    for (unsigned int i = 0; i < digitCount; i++) text[length++] = alphabet[digits[digitCount - 1 - i]];
+    text[length] = '\0';
 
-    if (RFXGEN_RAND01)
+    return length;
+}
+
+// Decode wave parameters from text (base58)
+RFXGENAPI bool DecodeWaveParamsText(const char *text, WaveParams *params)
+{
+    static const char *alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+    unsigned char bytes[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };   // Decoded bytes, little-endian
+    unsigned int byteCount = 0;
+    unsigned int zeroCount = 0;
+
+    if ((text == NULL) || (params == NULL)) return false;
+
+    while (text[zeroCount] == alphabet[0]) zeroCount++;
+
+    for (const char *c = text + zeroCount; *c != '\0'; c++)
     {
-        params.vibratoDepthValue = RFXGEN_RANDF(0.7f);
-        params.vibratoSpeedValue = RFXGEN_RANDF(0.6f);
+        const char *digit = strchr(alphabet, *c);
+        if (digit == NULL) return false;
+
+        unsigned int carry = (unsigned int)(digit - alphabet);
+
+        for (unsigned int j = 0; j < byteCount; j++)
+        {
+            carry += (unsigned int)bytes[j]*58;
+            bytes[j] = carry & 0xff;
+            carry >>= 8;
+        }
+
+        while (carry > 0)
+        {
+            if ((zeroCount + byteCount) >= RFXGEN_PARAMS_ENCODED_MAX_SIZE) return false;
+
+            bytes[byteCount++] = carry & 0xff;
+            carry >>= 8;
+        }
     }
 
-    if (RFXGEN_RAND(0, 2) == 0)
+    if (((zeroCount + byteCount) == 0) || ((zeroCount + byteCount) > RFXGEN_PARAMS_ENCODED_MAX_SIZE)) return false;
+
+    unsigned char data[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };
+    unsigned int size = zeroCount + byteCount;
+
+    for (unsigned int i = 0; i < byteCount; i++) data[zeroCount + i] = bytes[byteCount - 1 - i];
+
+    // All data must be consumed, trailing characters not allowed
+    return (DecodeWaveParams(data, size, params) == size);
+}
+
+//--------------------------------------------------------------------------------------------
+// Wave banks functions (parameters and PCM data)
+//--------------------------------------------------------------------------------------------
+
+// Save wave parameters bank file (.rfxb)
+// NOTE: Names are required to be unique, used for sounds lookup
+RFXGENAPI bool SaveWaveBank(const WaveParams *params, const char **names, unsigned int count, const char *fileName)
+{
+    // Fx Sound Bank File Structure (.rfxb)
+    // ------------------------------------------------------
+    // Offset | Size  | Type       | Description
+    // ------------------------------------------------------
+    // 0      | 4     | char       | Signature: "rFXB"
+    // 4      | 2     | short      | Version: 100
+    // 6      | 2     | short      | Entry size: 96 bytes (WaveParams)
+    // 8      | 4     | int        | Sounds count
+    // 12     | 4     | int        | Hash table slots count (power of 2)
+    // 16     | 4     | int        | Hash table offset
+    // 20     | 4     | int        | Entries offset (wave parameters)
+    // 24     | 4     | int        | Names offsets table offset
+    // 28     | 4     | int        | Reserved
+    // ------------------------------------------------------
+    // Hash table: slots*(name hash, sound id + 1), 0 for empty slots (linear probing)
+    // Wave parameters: count*WaveParams, packed array (same data than .rfx)
+    // Names offsets table: count*(name offset), names are NULL terminated strings
+    // NOTE: All values are little-endian, sections are 16 bytes aligned
+    // ------------------------------------------------------
+    bool success = false;
+
+    if ((params == NULL) || (names == NULL) || (count == 0) || !RFXGEN_ISFILEEXTENSION(fileName, ".rfxb")) return success;
+
+    unsigned int entriesOffset = 0;
+    unsigned int dataSize = 0;
+    unsigned char *data = LoadBankData("rFXB", sizeof(WaveParams), names, count, 0, &entriesOffset, &dataSize);
+
+    if (data != NULL)
     {
-        params.changeSpeedValue = 0.6f + RFXGEN_RANDF(0.3f);
-        params.changeAmountValue = 0.8f - RFXGEN_RANDF(1.6f);
+        RFXGEN_MEMCPY(data + entriesOffset, params, count*sizeof(WaveParams));
+        success = SaveBankData(data, dataSize, fileName);
+        RFXGEN_FREE(data);
     }
 
-    return params;
+    if (!success) RFXGEN_LOG("[%s] Failed to save wave bank\n", fileName);
+
+    return success;
 }
 
-// Generate sound: Powerup
-RLAPI WaveParams GenPowerup(void)
+// Save wave parameters bank file (.rfxb), parameters encoded quantized (8, 12, 16 bits)
+// NOTE: Same bank structure than SaveWaveBank(), signature "rFXQ", entries are encoded parameters offsets
+RFXGENAPI bool SaveWaveBankEncoded(const WaveParams *params, const char **names, unsigned int count, int bits, const char *fileName)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    // Fx Sound Encoded Bank File Structure (.rfxb)
+    // ------------------------------------------------------
+    // Header: Same as .rfxb, signature "rFXQ", entry size: 4 bytes
+    // Entries: count*(encoded parameters offset)
+    // Encoded parameters: count*(5..53 bytes), EncodeWaveParams() data, packed after entries
+    // Names offsets table: count*(name offset), names are NULL terminated strings
+    // ------------------------------------------------------
+    bool success = false;
+
+    if ((params == NULL) || (names == NULL) || (count == 0) || !RFXGEN_ISFILEEXTENSION(fileName, ".rfxb")) return success;
+
+    // Get encoded parameters total size, encoding is cheap compared to file writing
+    unsigned char encoded[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };
+    unsigned int encodedSize = 0;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int size = EncodeWaveParams(params[i], bits, encoded);
 
-    if (RFXGEN_RAND01) params.waveTypeValue = 1;
-    else params.squareDutyValue = RFXGEN_RANDF(0.6f);
+        if (size == 0)
+        {
+            RFXGEN_LOG("[%s] Wave parameters quantization not supported: %i bits\n", fileName, bits);
+            return success;
+        }
 
-    if (RFXGEN_RAND01)
-    {
-        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.3f);
-        params.slideValue = 0.1f + RFXGEN_RANDF(0.4f);
-        params.repeatSpeedValue = 0.4f + RFXGEN_RANDF(0.4f);
+        encodedSize += size;
     }
-    else
+
+    unsigned int entriesOffset = 0;
+    unsigned int dataSize = 0;
+    unsigned char *data = LoadBankData("rFXQ", 4, names, count, encodedSize, &entriesOffset, &dataSize);
+
+    if (data != NULL)
     {
-        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.3f);
-        params.slideValue = 0.05f + RFXGEN_RANDF(0.2f);
+        unsigned int position = entriesOffset + count*4;
 
-        if (RFXGEN_RAND01)
+        for (unsigned int i = 0; i < count; i++)
         {
-            params.vibratoDepthValue = RFXGEN_RANDF(0.7f);
-            params.vibratoSpeedValue = RFXGEN_RANDF(0.6f);
+            WriteU32LE(data + entriesOffset + i*4, position);
+            position += EncodeWaveParams(params[i], bits, data + position);
         }
+
+        success = SaveBankData(data, dataSize, fileName);
+        RFXGEN_FREE(data);
     }
 
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = RFXGEN_RANDF(0.4f);
-    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.4f);
+    if (!success) RFXGEN_LOG("[%s] Failed to save wave bank\n", fileName);
 
-    return params;
+    return success;
 }
 
-// Generate sound: Hit/Hurt
-RLAPI WaveParams GenHitHurt(void)
+// Load wave parameters bank file (memory-mapped)
+// NOTE: Bank data is not copied, only header and sections bounds are validated
+RFXGENAPI WaveBank LoadWaveBank(const char *fileName)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    WaveBank bank = { 0 };
+    unsigned int dataSize = 0;
+    unsigned char *data = (unsigned char *)RfxMapFile(fileName, &dataSize);
 
-    params.waveTypeValue = RFXGEN_RAND(0, 2);
-    if (params.waveTypeValue == 2) params.waveTypeValue = 3;
-    if (params.waveTypeValue == 0) params.squareDutyValue = RFXGEN_RANDF(0.6f);
+    if (data == NULL)
+    {
+        RFXGEN_LOG("[%s] Failed to open wave bank\n", fileName);
+        return bank;
+    }
 
-    params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.6f);
-    params.slideValue = -0.3f - RFXGEN_RANDF(0.4f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = RFXGEN_RANDF(0.1f);
-    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
+    if (IsBankDataValid(data, dataSize, "rFXB", sizeof(WaveParams)))
+    {
+        bank.soundCount = ReadU32LE(data + 8);
+        bank.params = (const WaveParams *)(data + ReadU32LE(data + 20));
+        bank.data = data;
+        bank.dataSize = dataSize;
+    }
+    else if (IsBankDataValid(data, dataSize, "rFXQ", 4))
+    {
+        // Encoded parameters, decoded on access (GetWaveBankSoundParams())
+        bank.soundCount = ReadU32LE(data + 8);
+        bank.data = data;
+        bank.dataSize = dataSize;
+    }
+    else
+    {
+        RFXGEN_LOG("[%s] Wave bank file not valid\n", fileName);
+        RfxUnmapFile(data, dataSize);
+    }
 
-    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
+    return bank;
+}
 
-    return params;
+// Check if wave parameters bank is valid
+RFXGENAPI bool IsWaveBankValid(WaveBank bank)
+{
+    return ((bank.data != NULL) && (bank.soundCount > 0));
 }
 
-// Generate sound: Jump
-RLAPI WaveParams GenJump(void)
+// Get bank sound id by name, -1 if not found
+RFXGENAPI int GetWaveBankSoundId(WaveBank bank, const char *name)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    return IsWaveBankValid(bank)? GetBankSoundId((const unsigned char *)bank.data, name) : -1;
+}
 
-    params.waveTypeValue = 0;
-    params.squareDutyValue = RFXGEN_RANDF(0.6f);
-    params.startFrequencyValue = 0.3f + RFXGEN_RANDF(0.3f);
-    params.slideValue = 0.1f + RFXGEN_RANDF(0.2f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.3f);
-    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
+// Get bank sound name by id
+RFXGENAPI const char *GetWaveBankSoundName(WaveBank bank, int id)
+{
+    return IsWaveBankValid(bank)? GetBankSoundName((const unsigned char *)bank.data, id) : NULL;
+}
 
-    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
-    if (RFXGEN_RAND01) params.lpfCutoffValue = 1.0f - RFXGEN_RANDF(0.6f);
+// Get bank sound parameters by name, NULL if not found
+RFXGENAPI const WaveParams *GetWaveBankSound(WaveBank bank, const char *name)
+{
+    int id = GetWaveBankSoundId(bank, name);
 
-    return params;
+    return ((id >= 0) && (bank.params != NULL))? &bank.params[id] : NULL;
 }
 
-// Generate sound: Blip/Select
-RLAPI WaveParams GenBlipSelect(void)
+// Get bank sound parameters by id, parameters are decoded for encoded banks
+// NOTE: Returns zeroed parameters if id or encoded data is not valid
+RFXGENAPI WaveParams GetWaveBankSoundParams(WaveBank bank, int id)
 {
     WaveParams params = { 0 };
-    ResetWaveParams(&params);
 
-    params.waveTypeValue = RFXGEN_RAND01;
-    if (params.waveTypeValue == 0) params.squareDutyValue = RFXGEN_RANDF(0.6f);
-    params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.4f);
-    params.attackTimeValue = 0.0f;
-    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.1f);
-    params.decayTimeValue = RFXGEN_RANDF(0.2f);
-    params.hpfCutoffValue = 0.1f;
+    if (!IsWaveBankValid(bank) || (id < 0) || ((unsigned int)id >= bank.soundCount)) return params;
+
+    if (bank.params != NULL) params = bank.params[id];
+    else
+    {
+        const unsigned char *data = (const unsigned char *)bank.data;
+        unsigned int offset = ReadU32LE(data + ReadU32LE(data + 20) + id*4);
+
+        if ((offset >= bank.dataSize) || (DecodeWaveParams(data + offset, bank.dataSize - offset, &params) == 0))
+        {
+            RFXGEN_LOG("WAVE: Bank sound encoded parameters not valid: %i\n", id);
+        }
+    }
 
     return params;
 }
 
-// Generate random sound
-RLAPI WaveParams GenRandomize(void)
+// Unload wave parameters bank
+RFXGENAPI void UnloadWaveBank(WaveBank bank)
 {
-    WaveParams params = { 0 };
-    ResetWaveParams(&params);
+    if (bank.data != NULL) RfxUnmapFile(bank.data, bank.dataSize);
+}
 
-    params.randSeed = RFXGEN_RAND(0, 0xFFFE);
+// Save wave data bank file (.rfxp), waves are stored in provided format
+// NOTE: Names are required to be unique, supported sample sizes: 8, 16, 32 bit
+RFXGENAPI bool SaveWavePcmBank(const WaveBuffer *waves, const char **names, unsigned int count, const char *fileName)
+{
+    // Fx Sound PCM Bank File Structure (.rfxp)
+    // ------------------------------------------------------
+    // Offset | Size  | Type       | Description
+    // ------------------------------------------------------
+    // 0      | 32    | ...        | Header: same layout than .rfxb, signature: "rFXP", entry size: 32 bytes
+    // ...    | ...   | ...        | Hash table: slots*(name hash, sound id + 1)
+    // ...    | ...   | ...        | Index entries: count*32 bytes
+    //        | 4     | int        | - Name hash
+    //        | 4     | int        | - Samples data offset (64 bytes aligned)
+    //        | 4     | int        | - Samples data size
+    //        | 4     | int        | - Frame count
+    //        | 4     | int        | - Sample rate
+    //        | 2     | short      | - Sample size (8, 16, 32)
+    //        | 2     | short      | - Channels
+    //        | 8     | int        | - Reserved
+    // ...    | ...   | ...        | Samples data: count*(PCM data), channels interleaved
+    // ...    | ...   | ...        | Names offsets table and NULL terminated names
+    // ------------------------------------------------------
+    bool success = false;
+
+    if ((waves == NULL) || (names == NULL) || (count == 0) || !RFXGEN_ISFILEEXTENSION(fileName, ".rfxp")) return success;
+
+    unsigned int samplesSize = 0;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if ((waves[i].data == NULL) || ((waves[i].sampleSize != 8) && (waves[i].sampleSize != 16) && (waves[i].sampleSize != 32)))
+        {
+            RFXGEN_LOG("[%s] Bank sound data not valid: %s\n", fileName, names[i]);
+            return success;
+        }
 
-    params.startFrequencyValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 2.0f);
+        samplesSize += RFXGEN_PCM_BANK_ALIGN(waves[i].frameCount*waves[i].channels*waves[i].sampleSize/8);
+    }
 
-    if (RFXGEN_RAND01) params.startFrequencyValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f)+0.5f;
+    unsigned int entriesOffset = 0;
+    unsigned int dataSize = 0;
+    unsigned char *data = LoadBankData("rFXP", 32, names, count, samplesSize + 64, &entriesOffset, &dataSize);
 
-    params.minFrequencyValue = 0.0f;
-    params.slideValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 5.0f);
+    if (data != NULL)
+    {
+        unsigned int samplesOffset = RFXGEN_PCM_BANK_ALIGN(entriesOffset + count*32);
 
-    if ((params.startFrequencyValue > 0.7f) && (params.slideValue > 0.2f)) params.slideValue = -params.slideValue;
-    if ((params.startFrequencyValue < 0.2f) && (params.slideValue < -0.05f)) params.slideValue = -params.slideValue;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            unsigned char *entry = data + entriesOffset + i*32;
+            unsigned int size = waves[i].frameCount*waves[i].channels*waves[i].sampleSize/8;
+
+            WriteU32LE(entry, RfxHashName(names[i]));
+            WriteU32LE(entry + 4, samplesOffset);
+            WriteU32LE(entry + 8, size);
+            WriteU32LE(entry + 12, waves[i].frameCount);
+            WriteU32LE(entry + 16, waves[i].sampleRate);
+            WriteU16LE(entry + 20, (unsigned short)waves[i].sampleSize);
+            WriteU16LE(entry + 22, (unsigned short)waves[i].channels);
+
+            RFXGEN_MEMCPY(data + samplesOffset, waves[i].data, size);
+            samplesOffset += RFXGEN_PCM_BANK_ALIGN(size);
+        }
 
-    params.deltaSlideValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.squareDutyValue = RFXGEN_RANDF(2.0f) - 1.0f;
-    params.dutySweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.vibratoDepthValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.vibratoSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
-    //params.vibratoPhaseDelay = RFXGEN_RANDF(2.0f) - 1.0f;
-    params.attackTimeValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.sustainTimeValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 2.0f);
-    params.decayTimeValue = RFXGEN_RANDF(2.0f)-1.0f;
-    params.sustainPunchValue = powf(RFXGEN_RANDF(0.8f), 2.0f);
+        success = SaveBankData(data, dataSize, fileName);
+        RFXGEN_FREE(data);
+    }
 
-    if (params.attackTimeValue + params.sustainTimeValue + params.decayTimeValue < 0.2f)
+    if (!success) RFXGEN_LOG("[%s] Failed to save wave bank\n", fileName);
+
+    return success;
+}
+
+// Load wave data bank file (memory-mapped)
+// NOTE: Bank data is not copied, every sound index entry is validated
+RFXGENAPI WavePcmBank LoadWavePcmBank(const char *fileName)
+{
+    WavePcmBank bank = { 0 };
+    unsigned int dataSize = 0;
+    unsigned char *data = (unsigned char *)RfxMapFile(fileName, &dataSize);
+
+    if (data == NULL)
     {
-        params.sustainTimeValue += 0.2f + RFXGEN_RANDF(0.3f);
-        params.decayTimeValue += 0.2f + RFXGEN_RANDF(0.3f);
+        RFXGEN_LOG("[%s] Failed to open wave bank\n", fileName);
+        return bank;
     }
 
-    params.lpfResonanceValue = RFXGEN_RANDF(2.0f) - 1.0f;
-    params.lpfCutoffValue = 1.0f - powf(RFXGEN_RANDF(1.0f), 3.0f);
-    params.lpfCutoffSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    bool valid = IsBankDataValid(data, dataSize, "rFXP", 32);
 
-    if (params.lpfCutoffValue < 0.1f && params.lpfCutoffSweepValue < -0.05f) params.lpfCutoffSweepValue = -params.lpfCutoffSweepValue;
+    for (unsigned int i = 0; valid && (i < ReadU32LE(data + 8)); i++)
+    {
+        const unsigned char *entry = data + ReadU32LE(data + 20) + i*32;
+        unsigned int offset = ReadU32LE(entry + 4);
+        unsigned int size = ReadU32LE(entry + 8);
+        unsigned int sampleSize = entry[20] | (entry[21] << 8);
+        unsigned int channels = entry[22] | (entry[23] << 8);
+
+        valid = ((offset & 63) == 0) && (offset <= dataSize) && (size <= (dataSize - offset)) && (channels > 0) &&
+                ((sampleSize == 8) || (sampleSize == 16) || (sampleSize == 32)) &&
+                ((unsigned long long)ReadU32LE(entry + 12)*channels*sampleSize/8 == size);
+    }
 
-    params.hpfCutoffValue = powf(RFXGEN_RANDF(1.0f), 5.0f);
-    params.hpfCutoffSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 5.0f);
-    params.phaserOffsetValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.phaserSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
-    params.repeatSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
-    params.changeSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
-    params.changeAmountValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    if (valid)
+    {
+        bank.soundCount = ReadU32LE(data + 8);
+        bank.data = data;
+        bank.dataSize = dataSize;
+    }
+    else
+    {
+        RFXGEN_LOG("[%s] Wave bank file not valid\n", fileName);
+        RfxUnmapFile(data, dataSize);
+    }
 
-    return params;
+    return bank;
 }
 
-// Mutate current sound
-RLAPI void WaveMutate(WaveParams *params)
+// Check if wave data bank is valid
+RFXGENAPI bool IsWavePcmBankValid(WavePcmBank bank)
 {
-    RFXGEN_SRAND(time(NULL));       // Refresh seed to avoid converging behaviour
-    
-    if (RFXGEN_RAND01) params->startFrequencyValue += RFXGEN_RANDF(0.1f) - 0.05f;        
-    //if (RFXGEN_RAND01) params.minFrequencyValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->slideValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->deltaSlideValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->squareDutyValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->dutySweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->vibratoDepthValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->vibratoSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    //if (RFXGEN_RAND01) params.vibratoPhaseDelay += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->attackTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->sustainTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->decayTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->sustainPunchValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->lpfResonanceValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->lpfCutoffValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->lpfCutoffSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->hpfCutoffValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->hpfCutoffSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->phaserOffsetValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->phaserSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->repeatSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->changeSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
-    if (RFXGEN_RAND01) params->changeAmountValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    return ((bank.data != NULL) && (bank.soundCount > 0));
+}
+
+// Get bank sound id by name, -1 if not found
+RFXGENAPI int GetWavePcmBankSoundId(WavePcmBank bank, const char *name)
+{
+    return IsWavePcmBankValid(bank)? GetBankSoundId((const unsigned char *)bank.data, name) : -1;
+}
+
+// Get bank sound name by id
+RFXGENAPI const char *GetWavePcmBankSoundName(WavePcmBank bank, int id)
+{
+    return IsWavePcmBankValid(bank)? GetBankSoundName((const unsigned char *)bank.data, id) : NULL;
+}
+
+// Get bank sound wave by id
+// NOTE: Wave data points into bank read-only memory, it must not be modified or unloaded
+RFXGENAPI WaveBuffer GetWavePcmBankSound(WavePcmBank bank, int id)
+{
+    WaveBuffer wave = { 0 };
+
+    if (IsWavePcmBankValid(bank) && (id >= 0) && ((unsigned int)id < bank.soundCount))
+    {
+        unsigned char *data = (unsigned char *)bank.data;
+        const unsigned char *entry = data + ReadU32LE(data + 20) + id*32;
+
+        wave.frameCount = ReadU32LE(entry + 12);
+        wave.sampleRate = ReadU32LE(entry + 16);
+        wave.sampleSize = entry[20] | (entry[21] << 8);
+        wave.channels = entry[22] | (entry[23] << 8);
+        wave.data = data + ReadU32LE(entry + 4);
+    }
+
+    return wave;
+}
+
+// Unload wave data bank
+RFXGENAPI void UnloadWavePcmBank(WavePcmBank bank)
+{
+    if (bank.data != NULL) RfxUnmapFile(bank.data, bank.dataSize);
+}
+
+//--------------------------------------------------------------------------------------------
+// Wave buffer conversion/export functions
+//--------------------------------------------------------------------------------------------
+
+// Copy wave buffer to a new wave buffer
+RFXGENAPI WaveBuffer WaveBufferCopy(WaveBuffer wave)
+{
+    WaveBuffer copy = { 0 };
+
+    if ((wave.data == NULL) || (wave.frameCount == 0)) return copy;
+
+    copy = wave;
+    copy.data = RFXGEN_CALLOC(wave.frameCount*wave.channels, wave.sampleSize/8);
+    if (copy.data != NULL) RFXGEN_MEMCPY(copy.data, wave.data, wave.frameCount*wave.channels*wave.sampleSize/8);
+    else copy = (WaveBuffer){ 0 };
+
+    return copy;
+}
+
+// Convert wave buffer data to desired format
+// NOTE: Sample rate conversion uses linear interpolation, channels are mixed if required
+RFXGENAPI void WaveBufferFormat(WaveBuffer *wave, int sampleRate, int sampleSize, int channels)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0)) return;
+    if ((sampleRate <= 0) || (channels <= 0) || ((sampleSize != 8) && (sampleSize != 16) && (sampleSize != 32)))
+    {
+        RFXGEN_LOG("WAVE: Format not supported (%i Hz, %i bit, %i channels)\n", sampleRate, sampleSize, channels);
+        return;
+    }
+
+    if ((wave->sampleRate == (unsigned int)sampleRate) &&
+        (wave->sampleSize == (unsigned int)sampleSize) &&
+        (wave->channels == (unsigned int)channels)) return;
+
+    unsigned int frameCount = (unsigned int)((unsigned long long)wave->frameCount*sampleRate/wave->sampleRate);
+    void *data = RFXGEN_CALLOC(frameCount*channels, sampleSize/8);
+    double step = (double)wave->sampleRate/sampleRate;
+
+    for (unsigned int i = 0; i < frameCount; i++)
+    {
+        double position = i*step;
+        unsigned int frame = (unsigned int)position;
+        unsigned int nextFrame = ((frame + 1) < wave->frameCount)? (frame + 1) : frame;
+        float factor = (float)(position - frame);
+
+        for (int c = 0; c < channels; c++)
+        {
+            float sample = GetWaveBufferSample(*wave, frame, c, channels);
+            if (factor > 0.0f) sample += (GetWaveBufferSample(*wave, nextFrame, c, channels) - sample)*factor;
+
+            SetSampleValue(data, sampleSize, i*channels + c, sample);
+        }
+    }
+
+    RFXGEN_FREE(wave->data);
+
+    wave->data = data;
+    wave->frameCount = frameCount;
+    wave->sampleRate = sampleRate;
+    wave->sampleSize = sampleSize;
+    wave->channels = channels;
+}
+
+// Export wave buffer to file
+// NOTE: Supported file formats: .wav, .qoa, .raw, .h, .bin (binary data + embedding .h)
+RFXGENAPI bool ExportWaveBuffer(WaveBuffer wave, const char *fileName)
+{
+    bool success = false;
+
+    if ((wave.data == NULL) || (wave.frameCount == 0)) return success;
+
+    if (RFXGEN_ISFILEEXTENSION(fileName, ".wav")) success = ExportWaveBufferWAV(wave, fileName);
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".qoa")) success = ExportWaveBufferQOA(wave, fileName);
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".raw")) success = ExportWaveBufferRAW(wave, fileName);
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".h")) success = ExportWaveBufferCode(wave, fileName);
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".bin")) success = ExportWaveBufferEmbed(wave, fileName);
+    else RFXGEN_LOG("[%s] Export file format not supported\n", fileName);
+
+    if (!success) RFXGEN_LOG("[%s] Failed to export wave data\n", fileName);
+
+    return success;
+}
+
+// Unload wave buffer data
+RFXGENAPI void UnloadWaveBuffer(WaveBuffer wave)
+{
+    RFXGEN_FREE(wave.data);
+}
+
+// Open wave file writer
+// NOTE: Supported file formats: .wav, .qoa (16 bit only), .raw
+// NOTE: sampleSize = 4 writes .wav files as IMA-ADPCM
+RFXGENAPI WaveWriter OpenWaveWriter(const char *fileName, int sampleRate, int sampleSize, int channels)
+{
+    WaveWriter writer = { 0 };
+
+    if ((sampleRate <= 0) || (channels <= 0) || ((sampleSize != 4) && (sampleSize != 8) && (sampleSize != 16) && (sampleSize != 32)))
+    {
+        RFXGEN_LOG("WAVE: Format not supported (%i Hz, %i bit, %i channels)\n", sampleRate, sampleSize, channels);
+        return writer;
+    }
+
+    if (RFXGEN_ISFILEEXTENSION(fileName, ".wav")) writer.fileType = (sampleSize == 4)? 3 : 0;
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".qoa"))
+    {
+        writer.fileType = 1;
+        sampleSize = 16;
+    }
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".raw") && (sampleSize != 4)) writer.fileType = 2;
+    else
+    {
+        RFXGEN_LOG("[%s] Streaming export file format not supported\n", fileName);
+        return writer;
+    }
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        RFXGEN_LOG("[%s] Failed to open file for writing\n", fileName);
+        return writer;
+    }
+
+    writer.sampleRate = sampleRate;
+    writer.sampleSize = sampleSize;
+    writer.channels = channels;
+    writer.file = file;
+
+    // Write file header, sizes are updated on closing
+    if (writer.fileType == 0)
+    {
+        unsigned char header[44] = { 0 };
+        SetWavHeader(header, writer.sampleRate, writer.sampleSize, writer.channels, 0);
+        fwrite(header, 1, 44, file);
+    }
+    else if (writer.fileType == 1)
+    {
+        unsigned char header[8] = { 'q', 'o', 'a', 'f', 0, 0, 0, 0 };
+        fwrite(header, 1, 8, file);
+        writer.encoder = LoadQoaEncoder(writer.sampleRate, writer.channels);
+
+        if (writer.encoder == NULL)
+        {
+            RFXGEN_LOG("[%s] QOA export supports up to 8 channels\n", fileName);
+            fclose(file);
+            writer = (WaveWriter){ 0 };
+        }
+    }
+    else if (writer.fileType == 3)
+    {
+        writer.encoder = LoadAdpcmEncoder(writer.sampleRate, writer.channels);
+
+        if (writer.encoder != NULL)
+        {
+            unsigned char header[60] = { 0 };
+            SetWavAdpcmHeader(header, writer.encoder, 0);
+            fwrite(header, 1, 60, file);
+        }
+        else
+        {
+            RFXGEN_LOG("[%s] ADPCM export supports up to 8 channels\n", fileName);
+            fclose(file);
+            writer = (WaveWriter){ 0 };
+        }
+    }
+
+    return writer;
+}
+
+// Check if wave writer is valid
+RFXGENAPI bool IsWaveWriterValid(WaveWriter writer)
+{
+    return (writer.file != NULL);
+}
+
+// Write float frames (channels interleaved), converted to writer format
+RFXGENAPI bool WriteWaveFrames(WaveWriter *writer, const float *frames, unsigned int frameCount)
+{
+    #define RFXGEN_WRITER_BUFFER_SIZE   4096    // Conversion buffer size in bytes
+
+    bool success = true;
+
+    if ((writer == NULL) || (writer->file == NULL)) return false;
+
+    if (writer->fileType == 1) success = QoaEncoderWrite(writer->encoder, (FILE *)writer->file, frames, frameCount);
+    else if (writer->fileType == 3) success = AdpcmEncoderWrite(writer->encoder, (FILE *)writer->file, frames, frameCount);
+    else
+    {
+        // Convert samples to writer sample size in small blocks, no big allocations required
+        unsigned char buffer[RFXGEN_WRITER_BUFFER_SIZE] = { 0 };
+        unsigned int sampleCount = frameCount*writer->channels;
+        unsigned int blockSamples = RFXGEN_WRITER_BUFFER_SIZE/(writer->sampleSize/8);
+
+        for (unsigned int i = 0; (i < sampleCount) && success; i += blockSamples)
+        {
+            unsigned int count = ((sampleCount - i) < blockSamples)? (sampleCount - i) : blockSamples;
+
+            for (unsigned int s = 0; s < count; s++) SetSampleValue(buffer, writer->sampleSize, s, frames[i + s]);
+
+            success = (fwrite(buffer, writer->sampleSize/8, count, (FILE *)writer->file) == count);
+        }
+    }
+
+    if (success) writer->frameCount += frameCount;
+
+    return success;
+}
+
+// Close wave writer, updating file header
+RFXGENAPI bool CloseWaveWriter(WaveWriter *writer)
+{
+    bool success = true;
+
+    if ((writer == NULL) || (writer->file == NULL)) return false;
+
+    FILE *file = (FILE *)writer->file;
+
+    if (writer->fileType == 0)
+    {
+        unsigned char header[44] = { 0 };
+        SetWavHeader(header, writer->sampleRate, writer->sampleSize, writer->channels, writer->frameCount*writer->channels*writer->sampleSize/8);
+
+        success = (fseek(file, 0, SEEK_SET) == 0) && (fwrite(header, 1, 44, file) == 44);
+    }
+    else if (writer->fileType == 1)
+    {
+        unsigned char samples[4] = { (unsigned char)((writer->frameCount >> 24) & 0xff), (unsigned char)((writer->frameCount >> 16) & 0xff), (unsigned char)((writer->frameCount >> 8) & 0xff), (unsigned char)(writer->frameCount & 0xff) };
+
+        success = QoaEncoderFlush(writer->encoder, file);
+        if (success) success = (fseek(file, 4, SEEK_SET) == 0) && (fwrite(samples, 1, 4, file) == 4);
+
+        UnloadQoaEncoder(writer->encoder);
+    }
+    else if (writer->fileType == 3)
+    {
+        unsigned char header[60] = { 0 };
+
+        success = AdpcmEncoderFlush(writer->encoder, file);
+        SetWavAdpcmHeader(header, writer->encoder, writer->frameCount);
+        if (success) success = (fseek(file, 0, SEEK_SET) == 0) && (fwrite(header, 1, 60, file) == 60);
+
+        UnloadAdpcmEncoder(writer->encoder);
+    }
+
+    if (fclose(file) != 0) success = false;
+
+    writer->file = NULL;
+    writer->encoder = NULL;
+
+    return success;
+}
+
+//--------------------------------------------------------------------------------------------
+// Wave IMA-ADPCM functions
+//--------------------------------------------------------------------------------------------
+
+// Export wave buffer as IMA-ADPCM .wav file (4 bit)
+// NOTE: Wave data is converted to 16 bit and encoded by blocks through the streaming writer
+RFXGENAPI bool ExportWaveBufferADPCM(WaveBuffer wave, const char *fileName)
+{
+    #define RFXGEN_ADPCM_EXPORT_SAMPLES  4096    // Conversion buffer size in samples
+
+    bool success = false;
+
+    if ((wave.data == NULL) || (wave.frameCount == 0)) return success;
+
+    WaveWriter writer = OpenWaveWriter(fileName, wave.sampleRate, 4, wave.channels);
+
+    if (IsWaveWriterValid(writer))
+    {
+        float frames[RFXGEN_ADPCM_EXPORT_SAMPLES] = { 0 };
+        unsigned int blockFrames = RFXGEN_ADPCM_EXPORT_SAMPLES/wave.channels;
+
+        success = true;
+
+        for (unsigned int i = 0; (i < wave.frameCount) && success; i += blockFrames)
+        {
+            unsigned int count = ((wave.frameCount - i) < blockFrames)? (wave.frameCount - i) : blockFrames;
+
+            for (unsigned int f = 0; f < count; f++)
+            {
+                for (unsigned int c = 0; c < wave.channels; c++) frames[f*wave.channels + c] = GetWaveBufferSample(wave, i + f, c, wave.channels);
+            }
+
+            success = WriteWaveFrames(&writer, frames, count);
+        }
+
+        if (!CloseWaveWriter(&writer)) success = false;
+    }
+
+    if (!success) RFXGEN_LOG("[%s] Failed to export wave data\n", fileName);
+
+    return success;
+}
+
+// Get number of frames contained in one ADPCM block
+// NOTE: Every channel stores a 4 byte header (first sample included) and 2 samples per byte,
+// channels data is interleaved in groups of 4 bytes, returns 0 if block size is not valid
+RFXGENAPI unsigned int GetAdpcmBlockFrames(unsigned int blockAlign, unsigned int channels)
+{
+    if ((channels == 0) || (blockAlign <= 4*channels) || (((blockAlign - 4*channels)%(4*channels)) != 0)) return 0;
+
+    return (blockAlign - 4*channels)*2/channels + 1;
+}
+
+// Decode one ADPCM block into 16 bit frames (channels interleaved)
+// NOTE: Blocks are independent, so they can be decoded in parallel or on demand (streaming),
+// samples decoding has no branches (table lookups, masks and clamping) and every channel is independent
+// NOTE: frames must hold GetAdpcmBlockFrames(blockAlign, channels)*channels samples, nothing decoded if block size is not valid
+RFXGENAPI void DecodeAdpcmBlock(const unsigned char *block, unsigned int blockAlign, unsigned int channels, short *frames)
+{
+    unsigned int blockFrames = GetAdpcmBlockFrames(blockAlign, channels);
+
+    if (blockFrames == 0) return;
+
+    for (unsigned int c = 0; c < channels; c++)
+    {
+        // Block channel header: first sample (16 bit), step index (8 bit), reserved (8 bit)
+        const unsigned char *header = block + 4*c;
+        AdpcmChannel state = { (short)(header[0] | (header[1] << 8)), (header[2] > 88)? 88 : header[2] };
+
+        frames[c] = (short)state.predictor;
+
+        // Channel data is interleaved in groups of 4 bytes (8 samples), low nibble first
+        for (unsigned int i = 1, group = 0; i < blockFrames; i += 8, group++)
+        {
+            const unsigned char *data = block + 4*channels + (group*channels + c)*4;
+
+            for (unsigned int k = 0; k < 4; k++)
+            {
+                frames[(i + 2*k)*channels + c] = (short)AdpcmExpandNibble(&state, data[k] & 0x0f);
+                frames[(i + 2*k + 1)*channels + c] = (short)AdpcmExpandNibble(&state, data[k] >> 4);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------
+// Sound generation functions
+//--------------------------------------------------------------------------------------------
+
+// Generate sound: Pickup/Coin
+RFXGENAPI WaveParams GenPickupCoin(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.startFrequencyValue = 0.4f + RFXGEN_RANDF(0.5f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = RFXGEN_RANDF(0.1f);
+    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.4f);
+    params.sustainPunchValue = 0.3f + RFXGEN_RANDF(0.3f);
+
+    if (RFXGEN_RAND01)
+    {
+        params.changeSpeedValue = 0.5f + RFXGEN_RANDF(0.2f);
+        params.changeAmountValue = 0.2f + RFXGEN_RANDF(0.4f);
+    }
+
+    return params;
+}
+
+// Generate sound: Laser shoot
+RFXGENAPI WaveParams GenLaserShoot(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = RFXGEN_RAND(0, 2);
+
+    if ((params.waveTypeValue == 2) && RFXGEN_RAND01) params.waveTypeValue = RFXGEN_RAND01;
+
+    params.startFrequencyValue = 0.5f + RFXGEN_RANDF(0.5f);
+    params.minFrequencyValue = params.startFrequencyValue - 0.2f - RFXGEN_RANDF(0.6f);
+
+    if (params.minFrequencyValue < 0.2f) params.minFrequencyValue = 0.2f;
+
+    params.slideValue = -0.15f - RFXGEN_RANDF(0.2f);
+
+    if (RFXGEN_RAND(0, 2) == 0)
+    {
+        params.startFrequencyValue = 0.3f + RFXGEN_RANDF(0.6f);
+        params.minFrequencyValue = RFXGEN_RANDF(0.1f);
+        params.slideValue = -0.35f - RFXGEN_RANDF(0.3f);
+    }
+
+    if (RFXGEN_RAND01)
+    {
+        params.squareDutyValue = RFXGEN_RANDF(0.5f);
+        params.dutySweepValue = RFXGEN_RANDF(0.2f);
+    }
+    else
+    {
+        params.squareDutyValue = 0.4f + RFXGEN_RANDF(0.5f);
+        params.dutySweepValue = -RFXGEN_RANDF(0.7f);
+    }
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
+    params.decayTimeValue = RFXGEN_RANDF(0.4f);
+
+    if (RFXGEN_RAND01) params.sustainPunchValue = RFXGEN_RANDF(0.3f);
+
+    if (RFXGEN_RAND(0, 2) == 0)
+    {
+        params.phaserOffsetValue = RFXGEN_RANDF(0.2f);
+        params.phaserSweepValue = -RFXGEN_RANDF(0.2f);
+    }
+
+    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
+
+    return params;
+}
+
+// Generate sound: Explosion
+RFXGENAPI WaveParams GenExplosion(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = 3;
+
+    if (RFXGEN_RAND01)
+    {
+        params.startFrequencyValue = 0.1f + RFXGEN_RANDF(0.4f);
+        params.slideValue = -0.1f + RFXGEN_RANDF(0.4f);
+    }
+    else
+    {
+        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.7f);
+        params.slideValue = -0.2f - RFXGEN_RANDF(0.2f);
+    }
+
+    params.startFrequencyValue *= params.startFrequencyValue;
+
+    if (RFXGEN_RAND(0, 4) == 0) params.slideValue = 0.0f;
+    if (RFXGEN_RAND(0, 2) == 0) params.repeatSpeedValue = 0.3f + RFXGEN_RANDF(0.5f);
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.3f);
+    params.decayTimeValue = RFXGEN_RANDF(0.5f);
+
+    if (RFXGEN_RAND01 == 0)
+    {
+        params.phaserOffsetValue = -0.3f + RFXGEN_RANDF(0.9f);
+        params.phaserSweepValue = -RFXGEN_RANDF(0.3f);
+    }
+
+    params.sustainPunchValue = 0.2f + RFXGEN_RANDF(0.6f);
+
+    if (RFXGEN_RAND01)
+    {
+        params.vibratoDepthValue = RFXGEN_RANDF(0.7f);
+        params.vibratoSpeedValue = RFXGEN_RANDF(0.6f);
+    }
+
+    if (RFXGEN_RAND(0, 2) == 0)
+    {
+        params.changeSpeedValue = 0.6f + RFXGEN_RANDF(0.3f);
+        params.changeAmountValue = 0.8f - RFXGEN_RANDF(1.6f);
+    }
+
+    return params;
+}
+
+// Generate sound: Powerup
+RFXGENAPI WaveParams GenPowerup(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    if (RFXGEN_RAND01) params.waveTypeValue = 1;
+    else params.squareDutyValue = RFXGEN_RANDF(0.6f);
+
+    if (RFXGEN_RAND01)
+    {
+        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.3f);
+        params.slideValue = 0.1f + RFXGEN_RANDF(0.4f);
+        params.repeatSpeedValue = 0.4f + RFXGEN_RANDF(0.4f);
+    }
+    else
+    {
+        params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.3f);
+        params.slideValue = 0.05f + RFXGEN_RANDF(0.2f);
+
+        if (RFXGEN_RAND01)
+        {
+            params.vibratoDepthValue = RFXGEN_RANDF(0.7f);
+            params.vibratoSpeedValue = RFXGEN_RANDF(0.6f);
+        }
+    }
+
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = RFXGEN_RANDF(0.4f);
+    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.4f);
+
+    return params;
+}
+
+// Generate sound: Hit/Hurt
+RFXGENAPI WaveParams GenHitHurt(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = RFXGEN_RAND(0, 2);
+    if (params.waveTypeValue == 2) params.waveTypeValue = 3;
+    if (params.waveTypeValue == 0) params.squareDutyValue = RFXGEN_RANDF(0.6f);
+
+    params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.6f);
+    params.slideValue = -0.3f - RFXGEN_RANDF(0.4f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = RFXGEN_RANDF(0.1f);
+    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
+
+    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
+
+    return params;
+}
+
+// Generate sound: Jump
+RFXGENAPI WaveParams GenJump(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = 0;
+    params.squareDutyValue = RFXGEN_RANDF(0.6f);
+    params.startFrequencyValue = 0.3f + RFXGEN_RANDF(0.3f);
+    params.slideValue = 0.1f + RFXGEN_RANDF(0.2f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.3f);
+    params.decayTimeValue = 0.1f + RFXGEN_RANDF(0.2f);
+
+    if (RFXGEN_RAND01) params.hpfCutoffValue = RFXGEN_RANDF(0.3f);
+    if (RFXGEN_RAND01) params.lpfCutoffValue = 1.0f - RFXGEN_RANDF(0.6f);
+
+    return params;
+}
+
+// Generate sound: Blip/Select
+RFXGENAPI WaveParams GenBlipSelect(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.waveTypeValue = RFXGEN_RAND01;
+    if (params.waveTypeValue == 0) params.squareDutyValue = RFXGEN_RANDF(0.6f);
+    params.startFrequencyValue = 0.2f + RFXGEN_RANDF(0.4f);
+    params.attackTimeValue = 0.0f;
+    params.sustainTimeValue = 0.1f + RFXGEN_RANDF(0.1f);
+    params.decayTimeValue = RFXGEN_RANDF(0.2f);
+    params.hpfCutoffValue = 0.1f;
+
+    return params;
+}
+
+// Generate random sound
+RFXGENAPI WaveParams GenRandomize(void)
+{
+    WaveParams params = { 0 };
+    ResetWaveParams(&params);
+
+    params.randSeed = RFXGEN_RAND(0, 0xFFFE);
+
+    params.startFrequencyValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 2.0f);
+
+    if (RFXGEN_RAND01) params.startFrequencyValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f)+0.5f;
+
+    params.minFrequencyValue = 0.0f;
+    params.slideValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 5.0f);
+
+    if ((params.startFrequencyValue > 0.7f) && (params.slideValue > 0.2f)) params.slideValue = -params.slideValue;
+    if ((params.startFrequencyValue < 0.2f) && (params.slideValue < -0.05f)) params.slideValue = -params.slideValue;
+
+    params.deltaSlideValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.squareDutyValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    params.dutySweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.vibratoDepthValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.vibratoSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    //params.vibratoPhaseDelay = RFXGEN_RANDF(2.0f) - 1.0f;
+    params.attackTimeValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.sustainTimeValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 2.0f);
+    params.decayTimeValue = RFXGEN_RANDF(2.0f)-1.0f;
+    params.sustainPunchValue = powf(RFXGEN_RANDF(0.8f), 2.0f);
+
+    if (params.attackTimeValue + params.sustainTimeValue + params.decayTimeValue < 0.2f)
+    {
+        params.sustainTimeValue += 0.2f + RFXGEN_RANDF(0.3f);
+        params.decayTimeValue += 0.2f + RFXGEN_RANDF(0.3f);
+    }
+
+    params.lpfResonanceValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    params.lpfCutoffValue = 1.0f - powf(RFXGEN_RANDF(1.0f), 3.0f);
+    params.lpfCutoffSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+
+    if (params.lpfCutoffValue < 0.1f && params.lpfCutoffSweepValue < -0.05f) params.lpfCutoffSweepValue = -params.lpfCutoffSweepValue;
+
+    params.hpfCutoffValue = powf(RFXGEN_RANDF(1.0f), 5.0f);
+    params.hpfCutoffSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 5.0f);
+    params.phaserOffsetValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.phaserSweepValue = powf(RFXGEN_RANDF(2.0f) - 1.0f, 3.0f);
+    params.repeatSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    params.changeSpeedValue = RFXGEN_RANDF(2.0f) - 1.0f;
+    params.changeAmountValue = RFXGEN_RANDF(2.0f) - 1.0f;
+
+    return params;
+}
+
+// Mutate current sound
+// NOTE: Random numbers sequence is not seeded again, consecutive mutations of same parameters differ,
+// seed it with RFXGEN_SRAND() to get repeatable mutations
+RFXGENAPI void WaveMutate(WaveParams *params)
+{
+    if (RFXGEN_RAND01) params->startFrequencyValue += RFXGEN_RANDF(0.1f) - 0.05f;        
+    //if (RFXGEN_RAND01) params.minFrequencyValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->slideValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->deltaSlideValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->squareDutyValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->dutySweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->vibratoDepthValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->vibratoSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    //if (RFXGEN_RAND01) params.vibratoPhaseDelay += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->attackTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->sustainTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->decayTimeValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->sustainPunchValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->lpfResonanceValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->lpfCutoffValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->lpfCutoffSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->hpfCutoffValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->hpfCutoffSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->phaserOffsetValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->phaserSweepValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->repeatSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->changeSpeedValue += RFXGEN_RANDF(0.1f) - 0.05f;
+    if (RFXGEN_RAND01) params->changeAmountValue += RFXGEN_RANDF(0.1f) - 0.05f;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Reset wave generator state from parameters
+// NOTE: On sound repeat only frequency, duty and arpeggio parameters are reset
+static void ResetWaveGeneratorState(WaveGeneratorState *state, bool restart)
+{
+    WaveParams *params = &state->params;
+
+    // Reset sample parameters
+    //----------------------------------------------------------------------------------------
+    state->fperiod = 100.0/(params->startFrequencyValue*params->startFrequencyValue + 0.001);
+    state->period = (int)state->fperiod;
+    state->fmaxperiod = 100.0/(params->minFrequencyValue*params->minFrequencyValue + 0.001);
+    state->fslide = 1.0 - pow((double)params->slideValue, 3.0)*0.01;
+    state->fdslide = -pow((double)params->deltaSlideValue, 3.0)*0.000001;
+    state->squareDuty = 0.5f - params->squareDutyValue*0.5f;
+    state->squareSlide = -params->dutySweepValue*0.00005f;
+
+    if (params->changeAmountValue >= 0.0f) state->arpeggioModulation = 1.0 - pow((double)params->changeAmountValue, 2.0)*0.9;
+    else state->arpeggioModulation = 1.0 + pow((double)params->changeAmountValue, 2.0)*10.0;
+
+    state->arpeggioTime = 0;
+    state->arpeggioLimit = (int)(powf(1.0f - params->changeSpeedValue, 2.0f)*20000 + 32);
+
+    if (params->changeSpeedValue == 1.0f) state->arpeggioLimit = 0;     // WATCH OUT: float comparison
+
+    if (restart) return;
+
+    // Reset filter parameters
+    state->fltw = powf(params->lpfCutoffValue, 3.0f)*0.1f;
+    state->fltwd = 1.0f + params->lpfCutoffSweepValue*0.0001f;
+    state->fltdmp = 5.0f/(1.0f + powf(params->lpfResonanceValue, 2.0f)*20.0f)*(0.01f + state->fltw);
+    if (state->fltdmp > 0.8f) state->fltdmp = 0.8f;
+    state->flthp = powf(params->hpfCutoffValue, 2.0f)*0.1f;
+    state->flthpd = 1.0f + params->hpfCutoffSweepValue*0.0003f;
+
+    // Reset vibrato
+    state->vibratoSpeed = powf(params->vibratoSpeedValue, 2.0f)*0.01f;
+    state->vibratoAmplitude = params->vibratoDepthValue*0.5f;
+
+    // Reset envelope
+    state->envelopeLength[0] = (int)(params->attackTimeValue*params->attackTimeValue*100000.0f);
+    state->envelopeLength[1] = (int)(params->sustainTimeValue*params->sustainTimeValue*100000.0f);
+    state->envelopeLength[2] = (int)(params->decayTimeValue*params->decayTimeValue*100000.0f);
+
+    state->fphase = powf(params->phaserOffsetValue, 2.0f)*1020.0f;
+    if (params->phaserOffsetValue < 0.0f) state->fphase = -state->fphase;
+
+    state->fdphase = powf(params->phaserSweepValue, 2.0f)*1.0f;
+    if (params->phaserSweepValue < 0.0f) state->fdphase = -state->fdphase;
+
+    state->iphase = abs((int)state->fphase);
+
+    for (int i = 0; i < 32; i++) state->noiseBuffer[i] = GetWaveGeneratorRandom(state, 2.0f) - 1.0f;
+
+    state->repeatLimit = (int)(powf(1.0f - params->repeatSpeedValue, 2.0f)*20000 + 32);
+
+    if (params->repeatSpeedValue == 0.0f) state->repeatLimit = 0;
+
+    state->generatingSample = true;
+    //----------------------------------------------------------------------------------------
+}
+
+// Get random value [0..range] from generator random state
+// NOTE: Linear congruential generator, same sequence on every platform and C library,
+// exported generator code uses the same algorithm (rfxSynthCode, ExportWaveParamsFunction())
+static float GetWaveGeneratorRandom(WaveGeneratorState *state, float range)
+{
+    state->randState = state->randState*1664525u + 1013904223u;
+
+    return ((float)((state->randState >> 8)%10000 + 1)/10000.0f)*range;
+}
+
+// Generate next wave sample using generator state
+static float GenerateWaveSample(WaveGeneratorState *state)
+{
+    const WaveParams *params = &state->params;
+
+    state->repeatTime++;
+
+    if ((state->repeatLimit != 0) && (state->repeatTime >= state->repeatLimit))
+    {
+        // Reset sample parameters (only some of them)
+        state->repeatTime = 0;
+        ResetWaveGeneratorState(state, true);
+    }
+
+    // Frequency envelopes/arpeggios
+    state->arpeggioTime++;
+
+    if ((state->arpeggioLimit != 0) && (state->arpeggioTime >= state->arpeggioLimit))
+    {
+        state->arpeggioLimit = 0;
+        state->fperiod *= state->arpeggioModulation;
+    }
+
+    state->fslide += state->fdslide;
+    state->fperiod *= state->fslide;
+
+    if (state->fperiod > state->fmaxperiod)
+    {
+        state->fperiod = state->fmaxperiod;
+
+        if (params->minFrequencyValue > 0.0f) state->generatingSample = false;
+    }
+
+    float rfperiod = (float)state->fperiod;
+
+    if (state->vibratoAmplitude > 0.0f)
+    {
+        state->vibratoPhase += state->vibratoSpeed;
+        rfperiod = (float)(state->fperiod*(1.0 + sinf(state->vibratoPhase)*state->vibratoAmplitude));
+    }
+
+    state->period = (int)rfperiod;
+
+    if (state->period < 8) state->period = 8;
+
+    state->squareDuty += state->squareSlide;
+
+    if (state->squareDuty < 0.0f) state->squareDuty = 0.0f;
+    if (state->squareDuty > 0.5f) state->squareDuty = 0.5f;
+
+    // Volume envelope
+    state->envelopeTime++;
+
+    if (state->envelopeTime > state->envelopeLength[state->envelopeStage])
+    {
+        state->envelopeTime = 0;
+        state->envelopeStage++;
+
+        if (state->envelopeStage == 3) state->generatingSample = false;
+    }
+
+    if (state->envelopeStage == 0) state->envelopeVolume = (float)state->envelopeTime/state->envelopeLength[0];
+    if (state->envelopeStage == 1) state->envelopeVolume = 1.0f + powf(1.0f - (float)state->envelopeTime/state->envelopeLength[1], 1.0f)*2.0f*params->sustainPunchValue;
+    if (state->envelopeStage == 2) state->envelopeVolume = 1.0f - (float)state->envelopeTime/state->envelopeLength[2];
+
+    // Phaser step
+    state->fphase += state->fdphase;
+    state->iphase = abs((int)state->fphase);
+
+    if (state->iphase > 1023) state->iphase = 1023;
+
+    if (state->flthpd != 0.0f)     // WATCH OUT!
+    {
+        state->flthp *= state->flthpd;
+        if (state->flthp < 0.00001f) state->flthp = 0.00001f;
+        if (state->flthp > 0.1f) state->flthp = 0.1f;
+    }
+
+    float ssample = 0.0f;
+
+    // Supersampling x8 by default, lower supersampling advances several supersamples per step
+    int substeps = RFXGEN_GEN_SUPERSAMPLING/state->supersampling;
+
+    for (int si = 0; si < state->supersampling; si++)
+    {
+        float sample = 0.0f;
+        state->phase += substeps;
+
+        if (state->phase >= state->period)
+        {
+            //phase = 0;
+            state->phase %= state->period;
+
+            if (params->waveTypeValue == 3)
+            {
+                for (int i = 0; i < 32; i++) state->noiseBuffer[i] = GetWaveGeneratorRandom(state, 2.0f) - 1.0f;
+            }
+        }
+
+        // base waveform
+        float fp = (float)state->phase/state->period;
+
+        switch (params->waveTypeValue)
+        {
+            case 0: // Square wave
+            {
+                if (fp < state->squareDuty) sample = 0.5f;
+                else sample = -0.5f;
+
+            } break;
+            case 1: sample = 1.0f - fp*2; break;    // Sawtooth wave
+            case 2: sample = sinf(fp*2*PI); break;  // Sine wave
+            case 3: sample = state->noiseBuffer[state->phase*32/state->period]; break; // Noise wave
+            default: break;
+        }
+
+        // LP filter
+        float pp = state->fltp;
+        if (state->fltwd != 1.0f) for (int i = 0; i < substeps; i++) state->fltw *= state->fltwd;
+
+        if (state->fltw < 0.0f) state->fltw = 0.0f;
+        if (state->fltw > 0.1f) state->fltw = 0.1f;
+
+        if (params->lpfCutoffValue != 1.0f)  // WATCH OUT!
+        {
+            state->fltdp += (sample - state->fltp)*state->fltw;
+            state->fltdp -= state->fltdp*state->fltdmp;
+        }
+        else
+        {
+            state->fltp = sample;
+            state->fltdp = 0.0f;
+        }
+
+        state->fltp += state->fltdp;
+
+        // HP filter
+        state->fltphp += state->fltp - pp;
+        state->fltphp -= state->fltphp*state->flthp;
+        sample = state->fltphp;
+
+        // Phaser
+        // NOTE: Skipped supersamples are filled with current sample, keeping delay line continuous
+        for (int i = 1; (i < substeps) && ((state->fphase != 0.0f) || (state->fdphase != 0.0f)); i++)
+        {
+            state->phaserBuffer[state->ipp & 1023] = sample;
+            state->ipp = (state->ipp + 1) & 1023;
+        }
+
+        state->phaserBuffer[state->ipp & 1023] = sample;
+        sample += state->phaserBuffer[(state->ipp - state->iphase + 1024) & 1023];
+        state->ipp = (state->ipp + 1) & 1023;
+
+        // Final accumulation and envelope application
+        ssample += sample*state->envelopeVolume;
+    }
+
+    #define SAMPLE_SCALE_COEFICIENT 0.2f    // NOTE: Used to scale sample value to [-1..1]
+
+    ssample = (ssample/state->supersampling)*SAMPLE_SCALE_COEFICIENT;
+
+    if (ssample > 1.0f) ssample = 1.0f;
+    if (ssample < -1.0f) ssample = -1.0f;
+
+    return ssample;
+}
+
+
+// Get frame sample as float, mixing channels if required
+// NOTE: Multi-channel to mono averages all channels, otherwise
+// missing channels replicate the last available one
+static float GetWaveBufferSample(WaveBuffer wave, unsigned int frame, unsigned int channel, unsigned int outChannels)
+{
+    float sample = 0.0f;
+
+    if ((outChannels == 1) && (wave.channels > 1))
+    {
+        for (unsigned int c = 0; c < wave.channels; c++) sample += GetWaveBufferSample(wave, frame, c, wave.channels);
+        sample /= (float)wave.channels;
+    }
+    else
+    {
+        unsigned int index = frame*wave.channels + ((channel < wave.channels)? channel : (wave.channels - 1));
+
+        if (wave.sampleSize == 8) sample = (float)(((unsigned char *)wave.data)[index] - 128)/128.0f;
+        else if (wave.sampleSize == 16) sample = (float)((short *)wave.data)[index]/32768.0f;
+        else if (wave.sampleSize == 32) sample = ((float *)wave.data)[index];
+    }
+
+    return sample;
+}
+
+// Set sample value from float into buffer, converting to sample size
+// NOTE: 8 bit samples are unsigned, 16 bit samples are signed, 32 bit samples are float
+static void SetSampleValue(void *data, int sampleSize, unsigned int index, float value)
+{
+    if (value > 1.0f) value = 1.0f;
+    else if (value < -1.0f) value = -1.0f;
+
+    if (sampleSize == 8) ((unsigned char *)data)[index] = (unsigned char)(value*127.0f + 128.0f);
+    else if (sampleSize == 16) ((short *)data)[index] = (short)(value*32767.0f);
+    else if (sampleSize == 32) ((float *)data)[index] = value;
+}
+
+// Write little-endian values into bytes array
+static void WriteU16LE(unsigned char *bytes, unsigned short value) { bytes[0] = value & 0xff; bytes[1] = (value >> 8) & 0xff; }
+static void WriteU32LE(unsigned char *bytes, unsigned int value) { WriteU16LE(bytes, value & 0xffff); WriteU16LE(bytes + 2, (value >> 16) & 0xffff); }
+
+// Read little-endian 32 bit value from bytes array
+static unsigned int ReadU32LE(const unsigned char *bytes) { return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24); }
+
+// Export wave buffer as .wav file
+// NOTE: 8 bit and 16 bit samples exported as PCM, 32 bit samples exported as IEEE float
+static bool ExportWaveBufferWAV(WaveBuffer wave, const char *fileName)
+{
+    bool success = false;
+
+    // WAV File Structure (.wav)
+    // ------------------------------------------------------
+    // Offset | Size  | Type       | Description
+    // ------------------------------------------------------
+    // 0      | 4     | char       | Signature: "RIFF"
+    // 4      | 4     | int        | File size - 8 bytes
+    // 8      | 4     | char       | Format: "WAVE"
+    // 12     | 4     | char       | Chunk id: "fmt "
+    // 16     | 4     | int        | Chunk size: 16 bytes
+    // 20     | 2     | short      | Audio format: 1 (PCM), 3 (IEEE float)
+    // 22     | 2     | short      | Channels
+    // 24     | 4     | int        | Sample rate
+    // 28     | 4     | int        | Byte rate
+    // 32     | 2     | short      | Block align
+    // 34     | 2     | short      | Bits per sample
+    // 36     | 4     | char       | Chunk id: "data"
+    // 40     | 4     | int        | Data size
+    // 44     | ...   | ...        | Samples data
+    // ------------------------------------------------------
+
+    unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+    unsigned char header[44] = { 0 };
+
+    SetWavHeader(header, wave.sampleRate, wave.sampleSize, wave.channels, dataSize);
+
+    FILE *wavFile = fopen(fileName, "wb");
+
+    if (wavFile != NULL)
+    {
+        success = (fwrite(header, 1, 44, wavFile) == 44);
+        if (success) success = (fwrite(wave.data, 1, dataSize, wavFile) == dataSize);
+
+        fclose(wavFile);
+    }
+
+    return success;
+}
+
+// Set .wav file header (44 bytes)
+static void SetWavHeader(unsigned char *header, unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int dataSize)
+{
+    memcpy(header, "RIFF", 4);
+    WriteU32LE(header + 4, 36 + dataSize);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    WriteU32LE(header + 16, 16);
+    WriteU16LE(header + 20, (sampleSize == 32)? 3 : 1);
+    WriteU16LE(header + 22, (unsigned short)channels);
+    WriteU32LE(header + 24, sampleRate);
+    WriteU32LE(header + 28, sampleRate*channels*sampleSize/8);
+    WriteU16LE(header + 32, (unsigned short)(channels*sampleSize/8));
+    WriteU16LE(header + 34, (unsigned short)sampleSize);
+    memcpy(header + 36, "data", 4);
+    WriteU32LE(header + 40, dataSize);
+}
+
+// QOA - The "Quite OK Audio" format, encoder implementation
+// NOTE: Based on qoa.h by Dominic Szablewski (MIT licensed), reference: https://qoaformat.org
+//----------------------------------------------------------------------------------
+#define QOA_MAGIC             0x716f6166    // 'qoaf'
+#define QOA_LMS_LEN                    4    // Least-mean-squares predictor length
+#define QOA_SLICE_LEN                 20    // Samples per slice
+#define QOA_SLICES_PER_FRAME         256    // Slices per frame
+#define QOA_FRAME_LEN  (QOA_SLICES_PER_FRAME*QOA_SLICE_LEN)   // Samples per frame (per channel): 5120
+#define QOA_MAX_CHANNELS               8    // Max supported channels
+#define QOA_FRAME_SIZE(channels, slices) (8 + QOA_LMS_LEN*4*(channels) + 8*(slices)*(channels))
+
+// QOA least-mean-squares predictor state
+typedef struct QoaLms {
+    int history[QOA_LMS_LEN];
+    int weights[QOA_LMS_LEN];
+} QoaLms;
+
+static const int qoaQuantTable[17] = {
+    7, 7, 7, 5, 5, 3, 3, 1,     // -8..-1
+    0,                          //  0
+    0, 2, 2, 4, 4, 6, 6, 6      //  1.. 8
+};
+
+static const int qoaScalefactorTable[16] = {
+    1, 7, 21, 45, 84, 138, 211, 304, 421, 562, 731, 928, 1157, 1419, 1715, 2048
+};
+
+static const int qoaReciprocalTable[16] = {
+    65536, 9363, 3121, 1457, 781, 475, 311, 216, 156, 117, 90, 71, 57, 47, 39, 32
+};
+
+static const int qoaDequantTable[16][8] = {
+    {    1,    -1,    3,    -3,    5,    -5,     7,     -7 },
+    {    5,    -5,   18,   -18,   32,   -32,    49,    -49 },
+    {   16,   -16,   53,   -53,   95,   -95,   147,   -147 },
+    {   34,   -34,  113,  -113,  203,  -203,   315,   -315 },
+    {   63,   -63,  210,  -210,  378,  -378,   588,   -588 },
+    {  104,  -104,  345,  -345,  621,  -621,   966,   -966 },
+    {  158,  -158,  528,  -528,  950,  -950,  1477,  -1477 },
+    {  228,  -228,  760,  -760, 1368, -1368,  2128,  -2128 },
+    {  316,  -316, 1053, -1053, 1895, -1895,  2947,  -2947 },
+    {  422,  -422, 1405, -1405, 2529, -2529,  3934,  -3934 },
+    {  548,  -548, 1828, -1828, 3290, -3290,  5117,  -5117 },
+    {  696,  -696, 2320, -2320, 4176, -4176,  6496,  -6496 },
+    {  868,  -868, 2893, -2893, 5207, -5207,  8099,  -8099 },
+    { 1064, -1064, 3548, -3548, 6386, -6386,  9933,  -9933 },
+    { 1286, -1286, 4288, -4288, 7718, -7718, 12005, -12005 },
+    { 1536, -1536, 5120, -5120, 9216, -9216, 14336, -14336 },
+};
+
+static int QoaLmsPredict(QoaLms *lms)
+{
+    int prediction = 0;
+    for (int i = 0; i < QOA_LMS_LEN; i++) prediction += lms->weights[i]*lms->history[i];
+    return prediction >> 13;
+}
+
+static void QoaLmsUpdate(QoaLms *lms, int sample, int residual)
+{
+    int delta = residual >> 4;
+    for (int i = 0; i < QOA_LMS_LEN; i++) lms->weights[i] += (lms->history[i] < 0)? -delta : delta;
+    for (int i = 0; i < (QOA_LMS_LEN - 1); i++) lms->history[i] = lms->history[i + 1];
+    lms->history[QOA_LMS_LEN - 1] = sample;
+}
+
+// Divide value by scalefactor, rounding away from zero
+static int QoaDiv(int value, int scalefactor)
+{
+    int n = (value*qoaReciprocalTable[scalefactor] + (1 << 15)) >> 16;
+    n = n + ((value > 0) - (value < 0)) - ((n > 0) - (n < 0));
+    return n;
+}
+
+// Init LMS state, weights {0, 0, -1, 2} help predicting the first samples of the file
+static void QoaInitLms(QoaLms *lms, unsigned int channels)
+{
+    for (unsigned int c = 0; c < channels; c++)
+    {
+        lms[c] = (QoaLms){ 0 };
+        lms[c].weights[2] = -(1 << 13);
+        lms[c].weights[3] = (1 << 14);
+    }
+}
+
+static int QoaClamp(int value, int min, int max) { return (value < min)? min : ((value > max)? max : value); }
+
+static void QoaWriteU64(unsigned long long value, unsigned char *bytes, unsigned int *position)
+{
+    for (int i = 7; i >= 0; i--) bytes[(*position)++] = (unsigned char)((value >> (i*8)) & 0xff);
+}
+
+// Encode one QOA frame from 16 bit channel-interleaved samples, returns frame size in bytes
+static unsigned int QoaEncodeFrame(const short *samples, unsigned int channels, unsigned int sampleRate, unsigned int frameLength, QoaLms *lms, unsigned char *bytes)
+{
+    unsigned int position = 0;
+    unsigned int slices = (frameLength + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN;
+    unsigned int frameSize = QOA_FRAME_SIZE(channels, slices);
+    int prevScalefactor[QOA_MAX_CHANNELS] = { 0 };
+
+    // Write frame header
+    QoaWriteU64((unsigned long long)channels << 56 | (unsigned long long)sampleRate << 32 | (unsigned long long)frameLength << 16 | frameSize, bytes, &position);
+
+    // Write current LMS state
+    for (unsigned int c = 0; c < channels; c++)
+    {
+        unsigned long long history = 0;
+        unsigned long long weights = 0;
+
+        for (int i = 0; i < QOA_LMS_LEN; i++)
+        {
+            history = (history << 16) | (lms[c].history[i] & 0xffff);
+            weights = (weights << 16) | (lms[c].weights[i] & 0xffff);
+        }
+
+        QoaWriteU64(history, bytes, &position);
+        QoaWriteU64(weights, bytes, &position);
+    }
+
+    // Encode samples with channels interleaved at slice level
+    for (unsigned int sampleIndex = 0; sampleIndex < frameLength; sampleIndex += QOA_SLICE_LEN)
+    {
+        for (unsigned int c = 0; c < channels; c++)
+        {
+            int sliceLength = QoaClamp(QOA_SLICE_LEN, 0, frameLength - sampleIndex);
+            int sliceStart = sampleIndex*channels + c;
+            int sliceEnd = (sampleIndex + sliceLength)*channels + c;
+
+            // Brute force search for the best scalefactor, starting with the previous slice one
+            unsigned long long bestRank = (unsigned long long)-1;
+            unsigned long long bestSlice = 0;
+            QoaLms bestLms = lms[c];
+            int bestScalefactor = 0;
+
+            for (int sfi = 0; sfi < 16; sfi++)
+            {
+                int scalefactor = (sfi + prevScalefactor[c])%16;
+
+                // Reset LMS state to last known good one before trying each scalefactor
+                QoaLms current = lms[c];
+                unsigned long long slice = scalefactor;
+                unsigned long long currentRank = 0;
+
+                for (int si = sliceStart; si < sliceEnd; si += channels)
+                {
+                    int sample = samples[si];
+                    int predicted = QoaLmsPredict(&current);
+
+                    int residual = sample - predicted;
+                    int scaled = QoaDiv(residual, scalefactor);
+                    int clamped = QoaClamp(scaled, -8, 8);
+                    int quantized = qoaQuantTable[clamped + 8];
+                    int dequantized = qoaDequantTable[scalefactor][quantized];
+                    int reconstructed = QoaClamp(predicted + dequantized, -32768, 32767);
+
+                    // Penalty for weights growing too large, it prevents pops/clicks
+                    int weightsPenalty = ((current.weights[0]*current.weights[0] +
+                                           current.weights[1]*current.weights[1] +
+                                           current.weights[2]*current.weights[2] +
+                                           current.weights[3]*current.weights[3]) >> 18) - 0x8ff;
+                    if (weightsPenalty < 0) weightsPenalty = 0;
+
+                    long long error = (sample - reconstructed);
+                    currentRank += (unsigned long long)(error*error) + (unsigned long long)weightsPenalty*weightsPenalty;
+
+                    if (currentRank > bestRank) break;
+
+                    QoaLmsUpdate(&current, reconstructed, dequantized);
+                    slice = (slice << 3) | quantized;
+                }
+
+                if (currentRank < bestRank)
+                {
+                    bestRank = currentRank;
+                    bestSlice = slice;
+                    bestLms = current;
+                    bestScalefactor = scalefactor;
+                }
+            }
+
+            prevScalefactor[c] = bestScalefactor;
+            lms[c] = bestLms;
+
+            // Short slices (last frame) must be left-shifted, rightmost bits are the empty ones
+            bestSlice <<= (QOA_SLICE_LEN - sliceLength)*3;
+            QoaWriteU64(bestSlice, bytes, &position);
+        }
+    }
+
+    return position;
+}
+
+// QOA frame encoding job
+// NOTE: LMS state is initialized per frame, so frames can be encoded independently (in parallel)
+typedef struct QoaFrameJob {
+    const short *samples;           // Frame samples (channels interleaved)
+    unsigned int frameLength;       // Frame length (samples per channel)
+    QoaLms lms[QOA_MAX_CHANNELS];   // LMS state at frame start
+    unsigned char *bytes;           // Encoded frame data
+    unsigned int size;              // Encoded frame size
+} QoaFrameJob;
+
+// QOA frames encoding task, every thread encodes a range of frames
+typedef struct QoaEncodeTask {
+    QoaFrameJob *jobs;
+    unsigned int jobCount;
+    unsigned int channels;
+    unsigned int sampleRate;
+} QoaEncodeTask;
+
+// Init frame LMS state from previous frame last input samples (QOA_LMS_LEN frames, channels interleaved)
+// NOTE: Weights are reset on every frame, previous samples are NULL for the first frame
+static void QoaInitFrameLms(QoaLms *lms, unsigned int channels, const short *previous)
+{
+    QoaInitLms(lms, channels);
+
+    if (previous != NULL)
+    {
+        for (unsigned int c = 0; c < channels; c++)
+        {
+            for (int i = 0; i < QOA_LMS_LEN; i++) lms[c].history[i] = previous[i*channels + c];
+        }
+    }
+}
+
+// Encode task frames (thread function)
+static void QoaEncodeFrameJobs(void *data)
+{
+    QoaEncodeTask *task = (QoaEncodeTask *)data;
+
+    for (unsigned int i = 0; i < task->jobCount; i++)
+    {
+        QoaFrameJob *job = &task->jobs[i];
+        job->size = QoaEncodeFrame(job->samples, task->channels, task->sampleRate, job->frameLength, job->lms, job->bytes);
+    }
+}
+
+// Encode QOA frames, distributed across available processors
+// NOTE: Encoded data is independent of the number of threads used
+static void QoaEncodeFrames(QoaFrameJob *jobs, unsigned int jobCount, unsigned int channels, unsigned int sampleRate)
+{
+    QoaEncodeTask tasks[RFXGEN_MAX_THREADS] = { 0 };
+    unsigned int threadCount = RfxGetProcessorCount();
+
+    if (threadCount > RFXGEN_MAX_THREADS) threadCount = RFXGEN_MAX_THREADS;
+    if (threadCount > jobCount) threadCount = jobCount;
+    if (threadCount == 0) return;
+
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        unsigned int first = jobCount*t/threadCount;
+
+        tasks[t].jobs = jobs + first;
+        tasks[t].jobCount = jobCount*(t + 1)/threadCount - first;
+        tasks[t].channels = channels;
+        tasks[t].sampleRate = sampleRate;
+    }
+
+#if !defined(RFXGEN_NO_THREADS)
+    RfxThread threads[RFXGEN_MAX_THREADS] = { 0 };
+    bool started[RFXGEN_MAX_THREADS] = { 0 };
+
+    // Current thread encodes first range, if a thread can not be created its range is encoded here
+    for (unsigned int t = 1; t < threadCount; t++) started[t] = RfxThreadCreate(&threads[t], QoaEncodeFrameJobs, &tasks[t]);
+
+    for (unsigned int t = 0; t < threadCount; t++)
+    {
+        if (!started[t]) QoaEncodeFrameJobs(&tasks[t]);
+    }
+
+    for (unsigned int t = 1; t < threadCount; t++)
+    {
+        if (started[t]) RfxThreadJoin(threads[t]);
+    }
+#else
+    for (unsigned int t = 0; t < threadCount; t++) QoaEncodeFrameJobs(&tasks[t]);
+#endif
+}
+
+// Export wave buffer as .qoa file
+// NOTE: QOA requires 16 bit samples, data is converted if required
+static bool ExportWaveBufferQOA(WaveBuffer wave, const char *fileName)
+{
+    bool success = false;
+
+    if ((wave.channels == 0) || (wave.channels > QOA_MAX_CHANNELS))
+    {
+        RFXGEN_LOG("[%s] QOA export supports up to %i channels\n", fileName, QOA_MAX_CHANNELS);
+        return success;
+    }
+
+    WaveBuffer qwave = wave;
+
+    if (wave.sampleSize != 16)
+    {
+        qwave.data = RFXGEN_CALLOC(wave.frameCount*wave.channels, sizeof(short));
+        qwave.sampleSize = 16;
+
+        if (qwave.data == NULL)
+        {
+            RFXGEN_LOG("[%s] Failed to allocate QOA samples data\n", fileName);
+            return success;
+        }
+
+        for (unsigned int i = 0; i < wave.frameCount; i++)
+        {
+            for (unsigned int c = 0; c < wave.channels; c++) SetSampleValue(qwave.data, 16, i*wave.channels + c, GetWaveBufferSample(wave, i, c, wave.channels));
+        }
+    }
+
+    unsigned int frames = (qwave.frameCount + QOA_FRAME_LEN - 1)/QOA_FRAME_LEN;
+    unsigned int slices = (qwave.frameCount + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN;
+    unsigned int encodedSize = 8 + frames*8 + frames*QOA_LMS_LEN*4*qwave.channels + slices*8*qwave.channels;
+    unsigned char *bytes = (unsigned char *)RFXGEN_CALLOC(encodedSize, 1);
+    QoaFrameJob *jobs = (QoaFrameJob *)RFXGEN_CALLOC(frames, sizeof(QoaFrameJob));
+
+    if ((bytes == NULL) || (jobs == NULL))
+    {
+        RFXGEN_LOG("[%s] Failed to allocate QOA encoding data\n", fileName);
+        RFXGEN_FREE(jobs);
+        RFXGEN_FREE(bytes);
+        if (qwave.data != wave.data) RFXGEN_FREE(qwave.data);
+        return success;
+    }
+
+    // Write file header and set every frame data position (frame sizes only depend on frame length)
+    unsigned int position = 0;
+    QoaWriteU64(((unsigned long long)QOA_MAGIC << 32) | qwave.frameCount, bytes, &position);
+
+    for (unsigned int i = 0; i < frames; i++)
+    {
+        unsigned int sampleIndex = i*QOA_FRAME_LEN;
+        const short *samples = (short *)qwave.data + sampleIndex*qwave.channels;
+
+        jobs[i].samples = samples;
+        jobs[i].frameLength = QoaClamp(QOA_FRAME_LEN, 0, qwave.frameCount - sampleIndex);
+        jobs[i].bytes = bytes + position;
+        QoaInitFrameLms(jobs[i].lms, qwave.channels, (i > 0)? (samples - QOA_LMS_LEN*qwave.channels) : NULL);
+
+        position += QOA_FRAME_SIZE(qwave.channels, (jobs[i].frameLength + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN);
+    }
+
+    QoaEncodeFrames(jobs, frames, qwave.channels, qwave.sampleRate);
+
+    FILE *qoaFile = fopen(fileName, "wb");
+
+    if (qoaFile != NULL)
+    {
+        success = (fwrite(bytes, 1, position, qoaFile) == position);
+        fclose(qoaFile);
+    }
+
+    RFXGEN_FREE(jobs);
+    RFXGEN_FREE(bytes);
+    if (qwave.data != wave.data) RFXGEN_FREE(qwave.data);
+
+    return success;
+}
+
+// QOA streaming encoder state
+// NOTE: Samples are encoded in batches of frames, one frame per thread
+typedef struct QoaEncoder {
+    unsigned int sampleRate;                                // Encoder sample rate
+    unsigned int channels;                                  // Encoder channels
+    unsigned int batchLength;                               // Frames encoded per batch
+    short *samples;                                         // Pending samples for next batch (channels interleaved)
+    unsigned int frameCount;                                // Pending frames count (samples per channel)
+    unsigned int framesEncoded;                             // QOA frames already encoded
+    short history[QOA_LMS_LEN*QOA_MAX_CHANNELS];            // Last input samples of previous batch
+    unsigned char *bytes;                                   // Encoded batch data
+} QoaEncoder;
+
+// Load QOA streaming encoder
+// NOTE: Returns NULL if channels are not supported or encoder data can not be allocated
+static void *LoadQoaEncoder(unsigned int sampleRate, unsigned int channels)
+{
+    if ((channels == 0) || (channels > QOA_MAX_CHANNELS)) return NULL;
+
+    QoaEncoder *encoder = (QoaEncoder *)RFXGEN_CALLOC(1, sizeof(QoaEncoder));
+    if (encoder == NULL) return NULL;
+
+    encoder->sampleRate = sampleRate;
+    encoder->channels = channels;
+    encoder->batchLength = RfxGetProcessorCount();
+    if (encoder->batchLength > RFXGEN_MAX_THREADS) encoder->batchLength = RFXGEN_MAX_THREADS;
+    encoder->samples = (short *)RFXGEN_CALLOC(encoder->batchLength*QOA_FRAME_LEN*channels, sizeof(short));
+    encoder->bytes = (unsigned char *)RFXGEN_CALLOC(encoder->batchLength, QOA_FRAME_SIZE(channels, QOA_SLICES_PER_FRAME));
+
+    if ((encoder->samples == NULL) || (encoder->bytes == NULL))
+    {
+        UnloadQoaEncoder(encoder);
+        encoder = NULL;
+    }
+
+    return encoder;
+}
+
+// Encode pending samples batch and write it to file
+static bool QoaEncoderWriteBatch(QoaEncoder *qoa, FILE *file)
+{
+    QoaFrameJob jobs[RFXGEN_MAX_THREADS] = { 0 };
+    unsigned int jobCount = (qoa->frameCount + QOA_FRAME_LEN - 1)/QOA_FRAME_LEN;
+    unsigned int size = 0;
+
+    for (unsigned int i = 0; i < jobCount; i++)
+    {
+        const short *samples = qoa->samples + i*QOA_FRAME_LEN*qoa->channels;
+
+        jobs[i].samples = samples;
+        jobs[i].frameLength = QoaClamp(QOA_FRAME_LEN, 0, qoa->frameCount - i*QOA_FRAME_LEN);
+        jobs[i].bytes = qoa->bytes + size;
+
+        if (i > 0) QoaInitFrameLms(jobs[i].lms, qoa->channels, samples - QOA_LMS_LEN*qoa->channels);
+        else QoaInitFrameLms(jobs[i].lms, qoa->channels, (qoa->framesEncoded > 0)? qoa->history : NULL);
+
+        size += QOA_FRAME_SIZE(qoa->channels, (jobs[i].frameLength + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN);
+    }
+
+    QoaEncodeFrames(jobs, jobCount, qoa->channels, qoa->sampleRate);
+
+    // Keep last input samples, required by next batch first frame
+    // NOTE: Only the last batch can be shorter than QOA_LMS_LEN frames
+    if (qoa->frameCount >= QOA_LMS_LEN) RFXGEN_MEMCPY(qoa->history, qoa->samples + (qoa->frameCount - QOA_LMS_LEN)*qoa->channels, QOA_LMS_LEN*qoa->channels*sizeof(short));
+
+    qoa->framesEncoded += jobCount;
+    qoa->frameCount = 0;
+
+    return (fwrite(qoa->bytes, 1, size, file) == size);
+}
+
+// Encode float frames, full QOA frames batches are written to file
+static bool QoaEncoderWrite(void *encoder, FILE *file, const float *frames, unsigned int frameCount)
+{
+    QoaEncoder *qoa = (QoaEncoder *)encoder;
+    bool success = true;
+
+    for (unsigned int i = 0; (i < frameCount) && success; i++)
+    {
+        for (unsigned int c = 0; c < qoa->channels; c++) SetSampleValue(qoa->samples, 16, qoa->frameCount*qoa->channels + c, frames[i*qoa->channels + c]);
+        qoa->frameCount++;
+
+        if (qoa->frameCount == qoa->batchLength*QOA_FRAME_LEN) success = QoaEncoderWriteBatch(qoa, file);
+    }
+
+    return success;
+}
+
+// Encode and write pending samples, last frame could be shorter
+static bool QoaEncoderFlush(void *encoder, FILE *file)
+{
+    QoaEncoder *qoa = (QoaEncoder *)encoder;
+    bool success = true;
+
+    if (qoa->frameCount > 0) success = QoaEncoderWriteBatch(qoa, file);
+
+    return success;
+}
+
+// Unload QOA streaming encoder
+static void UnloadQoaEncoder(void *encoder)
+{
+    QoaEncoder *qoa = (QoaEncoder *)encoder;
+
+    if (qoa != NULL)
+    {
+        RFXGEN_FREE(qoa->samples);
+        RFXGEN_FREE(qoa->bytes);
+        RFXGEN_FREE(qoa);
+    }
+}
+//----------------------------------------------------------------------------------
+
+// IMA-ADPCM - WAV format 0x0011, 4 bit samples, encoder/decoder implementation
+// NOTE: Reference: IMA Digital Audio Focus and Technical Working Groups, Recommended
+// Practices for Enhancing Digital Audio Compatibility in Multimedia Systems (1992)
+//----------------------------------------------------------------------------------
+#define ADPCM_MAX_CHANNELS             8    // Max supported channels
+
+static const int adpcmIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int adpcmStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+    12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Decode one ADPCM nibble, updating channel state
+// NOTE: Branchless, nibble bits select step fractions by masking
+static int AdpcmExpandNibble(AdpcmChannel *channel, int nibble)
+{
+    int step = adpcmStepTable[channel->index];
+    int sign = -((nibble >> 3) & 1);
+    int diff = (step >> 3) + (step & -((nibble >> 2) & 1)) + ((step >> 1) & -((nibble >> 1) & 1)) + ((step >> 2) & -(nibble & 1));
+    int predictor = channel->predictor + ((diff ^ sign) - sign);
+    int index = channel->index + adpcmIndexTable[nibble];
+
+    channel->predictor = (predictor < -32768)? -32768 : ((predictor > 32767)? 32767 : predictor);
+    channel->index = (index < 0)? 0 : ((index > 88)? 88 : index);
+
+    return channel->predictor;
+}
+
+// Encode one sample into ADPCM nibble, updating channel state
+static int AdpcmCompressSample(AdpcmChannel *channel, int sample)
+{
+    int step = adpcmStepTable[channel->index];
+    int diff = sample - channel->predictor;
+    int nibble = 0;
+
+    if (diff < 0) { nibble = 8; diff = -diff; }
+    if (diff >= step) { nibble |= 4; diff -= step; }
+    if (diff >= (step >> 1)) { nibble |= 2; diff -= (step >> 1); }
+    if (diff >= (step >> 2)) nibble |= 1;
+
+    // Encoder tracks decoder state, quantization errors are not accumulated
+    AdpcmExpandNibble(channel, nibble);
+
+    return nibble;
+}
+
+// IMA-ADPCM streaming encoder state
+typedef struct AdpcmEncoder {
+    unsigned int sampleRate;                                // Encoder sample rate
+    unsigned int channels;                                  // Encoder channels
+    unsigned int blockAlign;                                // Block size in bytes
+    unsigned int blockFrames;                               // Frames per block
+    short *samples;                                         // Pending samples for next block (channels interleaved)
+    unsigned int frameCount;                                // Pending frames count
+    unsigned int blocksWritten;                             // Blocks already written to file
+    AdpcmChannel state[ADPCM_MAX_CHANNELS];                 // Channels state, step index carried between blocks
+    unsigned char *block;                                   // Encoded block data
+} AdpcmEncoder;
+
+// Load IMA-ADPCM streaming encoder
+// NOTE: Block size scales with sample rate (256 bytes per channel at 11025 Hz), returns NULL if channels are not supported
+static void *LoadAdpcmEncoder(unsigned int sampleRate, unsigned int channels)
+{
+    if ((channels == 0) || (channels > ADPCM_MAX_CHANNELS)) return NULL;
+
+    AdpcmEncoder *encoder = (AdpcmEncoder *)RFXGEN_CALLOC(1, sizeof(AdpcmEncoder));
+    if (encoder == NULL) return NULL;
+
+    encoder->sampleRate = sampleRate;
+    encoder->channels = channels;
+    encoder->blockAlign = 256*channels*((sampleRate < 11025)? 1 : ((sampleRate >= 44100)? 4 : sampleRate/11025));
+    encoder->blockFrames = GetAdpcmBlockFrames(encoder->blockAlign, channels);
+    encoder->samples = (short *)RFXGEN_CALLOC(encoder->blockFrames*channels, sizeof(short));
+    encoder->block = (unsigned char *)RFXGEN_CALLOC(encoder->blockAlign, 1);
+
+    if ((encoder->samples == NULL) || (encoder->block == NULL))
+    {
+        UnloadAdpcmEncoder(encoder);
+        encoder = NULL;
+    }
+
+    return encoder;
+}
+
+// Encode pending block samples and write block to file
+static bool AdpcmEncoderWriteBlock(AdpcmEncoder *adpcm, FILE *file)
+{
+    unsigned int channels = adpcm->channels;
+
+    for (unsigned int c = 0; c < channels; c++)
+    {
+        // First block sample is stored uncompressed in channel header
+        adpcm->state[c].predictor = adpcm->samples[c];
+        WriteU16LE(adpcm->block + 4*c, (unsigned short)adpcm->samples[c]);
+        adpcm->block[4*c + 2] = (unsigned char)adpcm->state[c].index;
+        adpcm->block[4*c + 3] = 0;
+
+        for (unsigned int i = 1, group = 0; i < adpcm->blockFrames; i += 8, group++)
+        {
+            unsigned char *data = adpcm->block + 4*channels + (group*channels + c)*4;
+
+            for (unsigned int k = 0; k < 4; k++)
+            {
+                int low = AdpcmCompressSample(&adpcm->state[c], adpcm->samples[(i + 2*k)*channels + c]);
+                int high = AdpcmCompressSample(&adpcm->state[c], adpcm->samples[(i + 2*k + 1)*channels + c]);
+
+                data[k] = (unsigned char)(low | (high << 4));
+            }
+        }
+    }
+
+    adpcm->blocksWritten++;
+    adpcm->frameCount = 0;
+
+    return (fwrite(adpcm->block, 1, adpcm->blockAlign, file) == adpcm->blockAlign);
+}
+
+// Encode float frames, full blocks are written to file
+static bool AdpcmEncoderWrite(void *encoder, FILE *file, const float *frames, unsigned int frameCount)
+{
+    AdpcmEncoder *adpcm = (AdpcmEncoder *)encoder;
+    bool success = true;
+
+    for (unsigned int i = 0; (i < frameCount) && success; i++)
+    {
+        for (unsigned int c = 0; c < adpcm->channels; c++) SetSampleValue(adpcm->samples, 16, adpcm->frameCount*adpcm->channels + c, frames[i*adpcm->channels + c]);
+        adpcm->frameCount++;
+
+        if (adpcm->frameCount == adpcm->blockFrames) success = AdpcmEncoderWriteBlock(adpcm, file);
+    }
+
+    return success;
+}
+
+// Encode and write pending samples as last block
+// NOTE: Last block is padded with silence, real frame count is stored in "fact" chunk
+static bool AdpcmEncoderFlush(void *encoder, FILE *file)
+{
+    AdpcmEncoder *adpcm = (AdpcmEncoder *)encoder;
+    bool success = true;
+
+    if (adpcm->frameCount > 0)
+    {
+        memset(adpcm->samples + adpcm->frameCount*adpcm->channels, 0, (adpcm->blockFrames - adpcm->frameCount)*adpcm->channels*sizeof(short));
+        success = AdpcmEncoderWriteBlock(adpcm, file);
+    }
+
+    return success;
+}
+
+// Set IMA-ADPCM .wav file header (60 bytes)
+static void SetWavAdpcmHeader(unsigned char *header, const void *encoder, unsigned int frameCount)
+{
+    // WAV IMA-ADPCM File Structure (.wav)
+    // ------------------------------------------------------
+    // Offset | Size  | Type       | Description
+    // ------------------------------------------------------
+    // 0      | 4     | char       | Signature: "RIFF"
+    // 4      | 4     | int        | File size - 8 bytes
+    // 8      | 4     | char       | Format: "WAVE"
+    // 12     | 4     | char       | Chunk id: "fmt "
+    // 16     | 4     | int        | Chunk size: 20 bytes
+    // 20     | 2     | short      | Audio format: 0x0011 (IMA-ADPCM)
+    // 22     | 2     | short      | Channels
+    // 24     | 4     | int        | Sample rate
+    // 28     | 4     | int        | Byte rate
+    // 32     | 2     | short      | Block align (block size in bytes)
+    // 34     | 2     | short      | Bits per sample: 4
+    // 36     | 2     | short      | Extra format bytes: 2
+    // 38     | 2     | short      | Samples per block
+    // 40     | 4     | char       | Chunk id: "fact"
+    // 44     | 4     | int        | Chunk size: 4 bytes
+    // 48     | 4     | int        | Frames count
+    // 52     | 4     | char       | Chunk id: "data"
+    // 56     | 4     | int        | Data size
+    // 60     | ...   | ...        | Blocks data
+    // ------------------------------------------------------
+    const AdpcmEncoder *adpcm = (const AdpcmEncoder *)encoder;
+    unsigned int dataSize = adpcm->blocksWritten*adpcm->blockAlign;
+
+    memcpy(header, "RIFF", 4);
+    WriteU32LE(header + 4, 52 + dataSize);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    WriteU32LE(header + 16, 20);
+    WriteU16LE(header + 20, 0x0011);
+    WriteU16LE(header + 22, (unsigned short)adpcm->channels);
+    WriteU32LE(header + 24, adpcm->sampleRate);
+    WriteU32LE(header + 28, (unsigned int)((unsigned long long)adpcm->sampleRate*adpcm->blockAlign/adpcm->blockFrames));
+    WriteU16LE(header + 32, (unsigned short)adpcm->blockAlign);
+    WriteU16LE(header + 34, 4);
+    WriteU16LE(header + 36, 2);
+    WriteU16LE(header + 38, (unsigned short)adpcm->blockFrames);
+    memcpy(header + 40, "fact", 4);
+    WriteU32LE(header + 44, 4);
+    WriteU32LE(header + 48, frameCount);
+    memcpy(header + 52, "data", 4);
+    WriteU32LE(header + 56, dataSize);
+}
+
+// Unload IMA-ADPCM streaming encoder
+static void UnloadAdpcmEncoder(void *encoder)
+{
+    AdpcmEncoder *adpcm = (AdpcmEncoder *)encoder;
+
+    if (adpcm != NULL)
+    {
+        RFXGEN_FREE(adpcm->samples);
+        RFXGEN_FREE(adpcm->block);
+        RFXGEN_FREE(adpcm);
+    }
+}
+//----------------------------------------------------------------------------------
+
+// Export wave buffer as .raw file (samples data only)
+static bool ExportWaveBufferRAW(WaveBuffer wave, const char *fileName)
+{
+    bool success = false;
+    unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+
+    FILE *rawFile = fopen(fileName, "wb");
+
+    if (rawFile != NULL)
+    {
+        success = (fwrite(wave.data, 1, dataSize, rawFile) == dataSize);
+        fclose(rawFile);
+    }
+
+    return success;
+}
+
+// Export wave buffer as .h code file
+// NOTE: Same layout than raylib ExportWaveAsCode(): 32 bit data exported as
+// float array, 8/16 bit data exported as bytes array, frames are channel-interleaved
+static bool ExportWaveBufferCode(WaveBuffer wave, const char *fileName)
+{
+    #define RFXGEN_TEXT_BYTES_PER_LINE     20
+
+    bool success = false;
+
+    // Get file name from path and convert variable name to uppercase
+    char varFileName[256] = { 0 };
+    SetCodeVarName(varFileName, fileName);
+
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile != NULL)
+    {
+        unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+
+        fprintf(codeFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// WaveAsCode exporter v1.1 - Wave data exported as an array of bytes           //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/rfxgen                        //\n");
+        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// Copyright (c) 2018-2026 raylib technologies (@raylibtech)                    //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        // Add wave information
+        fprintf(codeFile, "// Wave data information\n");
+        fprintf(codeFile, "#define %s_FRAME_COUNT      %u\n", varFileName, wave.frameCount);
+        fprintf(codeFile, "#define %s_SAMPLE_RATE      %u\n", varFileName, wave.sampleRate);
+        fprintf(codeFile, "#define %s_SAMPLE_SIZE      %u\n", varFileName, wave.sampleSize);
+        fprintf(codeFile, "#define %s_CHANNELS         %u\n\n", varFileName, wave.channels);
+
+        // Write wave data as an array of values
+        if (wave.sampleSize == 32)
+        {
+            fprintf(codeFile, "static float %s_DATA[%u] = {\n    ", varFileName, dataSize/4);
+            for (unsigned int i = 1; i < dataSize/4; i++) fprintf(codeFile, ((i%RFXGEN_TEXT_BYTES_PER_LINE == 0)? "%.4ff,\n    " : "%.4ff, "), ((float *)wave.data)[i - 1]);
+            fprintf(codeFile, "%.4ff };\n", ((float *)wave.data)[dataSize/4 - 1]);
+        }
+        else
+        {
+            fprintf(codeFile, "static unsigned char %s_DATA[%u] = { ", varFileName, dataSize);
+            for (unsigned int i = 1; i < dataSize; i++) fprintf(codeFile, ((i%RFXGEN_TEXT_BYTES_PER_LINE == 0)? "0x%x,\n    " : "0x%x, "), ((unsigned char *)wave.data)[i - 1]);
+            fprintf(codeFile, "0x%x };\n", ((unsigned char *)wave.data)[dataSize - 1]);
+        }
+
+        success = (ferror(codeFile) == 0);
+        fclose(codeFile);
+    }
+
+    return success;
+}
+
+// Export wave buffer as .bin data file and .h embedding header
+// NOTE: Header is saved next to data file (same name, .h extension) and defines same symbols
+// than .h code export, data is embedded at compile time with #embed (C23) or .incbin (GCC/Clang),
+// compilers do not need to parse a text array, useful when many sounds are embedded
+static bool ExportWaveBufferEmbed(WaveBuffer wave, const char *fileName)
+{
+    bool success = false;
+
+    // Get file name from path, data file is referenced relative to header
+    const char *baseName = fileName;
+    for (const char *c = fileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) baseName = c + 1;
+
+    char varFileName[256] = { 0 };
+    SetCodeVarName(varFileName, fileName);
+
+    // Header file name: data file name with .h extension
+    int length = (int)strlen(fileName);
+    if (length >= 508) return success;
+
+    char headerFileName[512] = { 0 };
+    RFXGEN_MEMCPY(headerFileName, fileName, length - 4);
+    strcat(headerFileName, ".h");
+
+    if (!ExportWaveBufferRAW(wave, fileName)) return success;
+
+    FILE *codeFile = fopen(headerFileName, "wt");
+
+    if (codeFile != NULL)
+    {
+        const char *name = varFileName;
+        unsigned int dataSize = wave.frameCount*wave.channels*wave.sampleSize/8;
+
+        fprintf(codeFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// WaveAsEmbed exporter v1.0 - Wave data embedded from binary file              //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/rfxgen                        //\n");
+        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// Copyright (c) 2018-2026 raylib technologies (@raylibtech)                    //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        // Add wave information
+        fprintf(codeFile, "// Wave data information\n");
+        fprintf(codeFile, "#define %s_FRAME_COUNT      %u\n", name, wave.frameCount);
+        fprintf(codeFile, "#define %s_SAMPLE_RATE      %u\n", name, wave.sampleRate);
+        fprintf(codeFile, "#define %s_SAMPLE_SIZE      %u\n", name, wave.sampleSize);
+        fprintf(codeFile, "#define %s_CHANNELS         %u\n", name, wave.channels);
+        fprintf(codeFile, "#define %s_DATA_SIZE        %u\n\n", name, dataSize);
+
+        // Add data file path, #embed searches relative to this header, .incbin relative to build directory
+        fprintf(codeFile, "// Wave data file: path relative to this header (#embed) or build directory (.incbin)\n");
+        fprintf(codeFile, "// NOTE: Define %s_DATA_FILE before including this header to override it\n", name);
+        fprintf(codeFile, "#ifndef %s_DATA_FILE\n", name);
+        fprintf(codeFile, "    #define %s_DATA_FILE        \"%s\"\n", name, baseName);
+        fprintf(codeFile, "#endif\n\n");
+
+        // Embed data with #embed (C23: GCC 15, Clang 19), aligned to allow 32 bit float access
+        fprintf(codeFile, "#if defined(__has_embed)\n");
+        fprintf(codeFile, "_Alignas(16) static const unsigned char %s_DATA_BYTES[%s_DATA_SIZE] = {\n", name, name);
+        fprintf(codeFile, "#embed %s_DATA_FILE\n", name);
+        fprintf(codeFile, "};\n");
+
+        // Embed data with assembler .incbin directive, symbol is local to the translation unit
+        fprintf(codeFile, "#elif defined(__GNUC__)\n");
+        fprintf(codeFile, "#ifndef RFXGEN_EMBED_SECTION\n");
+        fprintf(codeFile, "    #define RFXGEN_EMBED_STR(x) #x\n");
+        fprintf(codeFile, "    #define RFXGEN_EMBED_LABEL(x) RFXGEN_EMBED_STR(x)\n");
+        fprintf(codeFile, "    #if defined(__APPLE__)\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_SECTION \"    .const\\n\"\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_PREVIOUS \"    .text\\n\"\n");
+        fprintf(codeFile, "    #elif defined(_WIN32)\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_SECTION \"    .pushsection .rdata, \\\"dr\\\"\\n\"\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_PREVIOUS \"    .popsection\\n\"\n");
+        fprintf(codeFile, "    #else\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_SECTION \"    .pushsection .rodata\\n\"\n");
+        fprintf(codeFile, "        #define RFXGEN_EMBED_PREVIOUS \"    .popsection\\n\"\n");
+        fprintf(codeFile, "    #endif\n");
+        fprintf(codeFile, "#endif\n");
+        fprintf(codeFile, "__asm__(RFXGEN_EMBED_SECTION\n");
+        fprintf(codeFile, "    \"    .balign 16\\n\"\n");
+        fprintf(codeFile, "    RFXGEN_EMBED_LABEL(__USER_LABEL_PREFIX__) \"%s_DATA_BYTES:\\n\"\n", name);
+        fprintf(codeFile, "    \"    .incbin \\\"\" %s_DATA_FILE \"\\\"\\n\"\n", name);
+        fprintf(codeFile, "    RFXGEN_EMBED_PREVIOUS);\n");
+        fprintf(codeFile, "extern const unsigned char %s_DATA_BYTES[%s_DATA_SIZE];\n", name, name);
+        fprintf(codeFile, "#else\n");
+        fprintf(codeFile, "    #error \"%s: #embed or .incbin required, export wave as code file (.h)\"\n", name);
+        fprintf(codeFile, "#endif\n\n");
+
+        // Data symbol, same type than .h code export
+        if (wave.sampleSize == 32) fprintf(codeFile, "#define %s_DATA ((const float *)%s_DATA_BYTES)\n", name, name);
+        else fprintf(codeFile, "#define %s_DATA %s_DATA_BYTES\n", name, name);
+
+        success = (ferror(codeFile) == 0);
+        fclose(codeFile);
+    }
+
+    return success;
+}
+
+// Set code variable name from file name: no path or extension, uppercase, only alphanumeric
+static void SetCodeVarName(char *varName, const char *fileName)
+{
+    const char *baseName = fileName;
+    for (const char *c = fileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) baseName = c + 1;
+
+    for (int i = 0; (baseName[i] != '\0') && (baseName[i] != '.') && (i < 255); i++)
+    {
+        char c = baseName[i];
+        if ((c >= 'a') && (c <= 'z')) c -= 32;
+        else if (!(((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')))) c = '_';
+        varName[i] = c;
+    }
+}
+
+// Minimal wave generator code, written by ExportWaveParamsCode()
+// NOTE: Same algorithm than ResetWaveGeneratorState() and GenerateWaveSample(), both must be kept in sync,
+// drift is detected by rfxgen_test (exported sounds compared with GenerateWave() output)
+static const char *rfxSynthCode[] = {
+    "#ifndef RFXGEN_SYNTH",
+    "#define RFXGEN_SYNTH",
+    "",
+    "#include <stdlib.h>     // Required for: rand(), abs()",
+    "#include <math.h>       // Required for: pow(), powf(), sinf()",
+    "",
+    "// Sound parameters (same layout than rfxgen WaveParams, 96 bytes)",
+    "typedef struct RfxSynthParams {",
+    "    int randSeed, waveType;",
+    "    float attackTime, sustainTime, sustainPunch, decayTime;",
+    "    float startFrequency, minFrequency, slide, deltaSlide, vibratoDepth, vibratoSpeed;",
+    "    float changeAmount, changeSpeed, squareDuty, dutySweep, repeatSpeed;",
+    "    float phaserOffset, phaserSweep;",
+    "    float lpfCutoff, lpfCutoffSweep, lpfResonance, hpfCutoff, hpfCutoffSweep;",
+    "} RfxSynthParams;",
+    "",
+    "// Sound generator state",
+    "typedef struct RfxSynthState {",
+    "    RfxSynthParams p;",
+    "    int phase, period, envStage, envTime, envLength[3], iphase, ipp;",
+    "    int repeatTime, repeatLimit, arpTime, arpLimit, generating;",
+    "    double fperiod, fmaxperiod, fslide, fdslide, arpMod;",
+    "    float squareDuty, squareSlide, envVolume, fphase, fdphase;",
+    "    float fltp, fltdp, fltw, fltwd, fltdmp, fltphp, flthp, flthpd;",
+    "    float vibPhase, vibSpeed, vibAmplitude;",
+    "    float noise[32], phaser[1024];",
+    "    unsigned int randState;",
+    "} RfxSynthState;",
+    "",
+    "// Get random value [0..range] from generator random state (linear congruential generator)",
+    "static inline float RfxSynthRand(RfxSynthState *s, float range)",
+    "{",
+    "    s->randState = s->randState*1664525u + 1013904223u;",
+    "    return ((float)((s->randState >> 8)%10000 + 1)/10000.0f)*range;",
+    "}",
+    "",
+    "// Reset generator state (restart: sound repeat)",
+    "static inline void RfxSynthReset(RfxSynthState *s, int restart)",
+    "{",
+    "    const RfxSynthParams *p = &s->p;",
+    "",
+    "    s->fperiod = 100.0/(p->startFrequency*p->startFrequency + 0.001);",
+    "    s->period = (int)s->fperiod;",
+    "    s->fmaxperiod = 100.0/(p->minFrequency*p->minFrequency + 0.001);",
+    "    s->fslide = 1.0 - pow((double)p->slide, 3.0)*0.01;",
+    "    s->fdslide = -pow((double)p->deltaSlide, 3.0)*0.000001;",
+    "    s->squareDuty = 0.5f - p->squareDuty*0.5f;",
+    "    s->squareSlide = -p->dutySweep*0.00005f;",
+    "    if (p->changeAmount >= 0.0f) s->arpMod = 1.0 - pow((double)p->changeAmount, 2.0)*0.9;",
+    "    else s->arpMod = 1.0 + pow((double)p->changeAmount, 2.0)*10.0;",
+    "    s->arpTime = 0;",
+    "    s->arpLimit = (int)(powf(1.0f - p->changeSpeed, 2.0f)*20000 + 32);",
+    "    if (p->changeSpeed == 1.0f) s->arpLimit = 0;",
+    "    if (restart) return;",
+    "",
+    "    s->fltw = powf(p->lpfCutoff, 3.0f)*0.1f;",
+    "    s->fltwd = 1.0f + p->lpfCutoffSweep*0.0001f;",
+    "    s->fltdmp = 5.0f/(1.0f + powf(p->lpfResonance, 2.0f)*20.0f)*(0.01f + s->fltw);",
+    "    if (s->fltdmp > 0.8f) s->fltdmp = 0.8f;",
+    "    s->flthp = powf(p->hpfCutoff, 2.0f)*0.1f;",
+    "    s->flthpd = 1.0f + p->hpfCutoffSweep*0.0003f;",
+    "    s->vibSpeed = powf(p->vibratoSpeed, 2.0f)*0.01f;",
+    "    s->vibAmplitude = p->vibratoDepth*0.5f;",
+    "    s->envLength[0] = (int)(p->attackTime*p->attackTime*100000.0f);",
+    "    s->envLength[1] = (int)(p->sustainTime*p->sustainTime*100000.0f);",
+    "    s->envLength[2] = (int)(p->decayTime*p->decayTime*100000.0f);",
+    "    s->fphase = powf(p->phaserOffset, 2.0f)*1020.0f;",
+    "    if (p->phaserOffset < 0.0f) s->fphase = -s->fphase;",
+    "    s->fdphase = powf(p->phaserSweep, 2.0f)*1.0f;",
+    "    if (p->phaserSweep < 0.0f) s->fdphase = -s->fdphase;",
+    "    s->iphase = abs((int)s->fphase);",
+    "    for (int i = 0; i < 32; i++) s->noise[i] = RfxSynthRand(s, 2.0f) - 1.0f;",
+    "    s->repeatLimit = (int)(powf(1.0f - p->repeatSpeed, 2.0f)*20000 + 32);",
+    "    if (p->repeatSpeed == 0.0f) s->repeatLimit = 0;",
+    "    s->generating = 1;",
+    "}",
+    "",
+    "// Generate next sample",
+    "static inline float RfxSynthSample(RfxSynthState *s)",
+    "{",
+    "    const RfxSynthParams *p = &s->p;",
+    "",
+    "    s->repeatTime++;",
+    "    if ((s->repeatLimit != 0) && (s->repeatTime >= s->repeatLimit)) { s->repeatTime = 0; RfxSynthReset(s, 1); }",
+    "",
+    "    s->arpTime++;",
+    "    if ((s->arpLimit != 0) && (s->arpTime >= s->arpLimit)) { s->arpLimit = 0; s->fperiod *= s->arpMod; }",
+    "",
+    "    s->fslide += s->fdslide;",
+    "    s->fperiod *= s->fslide;",
+    "    if (s->fperiod > s->fmaxperiod)",
+    "    {",
+    "        s->fperiod = s->fmaxperiod;",
+    "        if (p->minFrequency > 0.0f) s->generating = 0;",
+    "    }",
+    "",
+    "    float rfperiod = (float)s->fperiod;",
+    "    if (s->vibAmplitude > 0.0f)",
+    "    {",
+    "        s->vibPhase += s->vibSpeed;",
+    "        rfperiod = (float)(s->fperiod*(1.0 + sinf(s->vibPhase)*s->vibAmplitude));",
+    "    }",
+    "    s->period = (int)rfperiod;",
+    "    if (s->period < 8) s->period = 8;",
+    "",
+    "    s->squareDuty += s->squareSlide;",
+    "    if (s->squareDuty < 0.0f) s->squareDuty = 0.0f;",
+    "    if (s->squareDuty > 0.5f) s->squareDuty = 0.5f;",
+    "",
+    "    s->envTime++;",
+    "    if (s->envTime > s->envLength[s->envStage])",
+    "    {",
+    "        s->envTime = 0;",
+    "        s->envStage++;",
+    "        if (s->envStage == 3) s->generating = 0;",
+    "    }",
+    "    if (s->envStage == 0) s->envVolume = (float)s->envTime/s->envLength[0];",
+    "    if (s->envStage == 1) s->envVolume = 1.0f + powf(1.0f - (float)s->envTime/s->envLength[1], 1.0f)*2.0f*p->sustainPunch;",
+    "    if (s->envStage == 2) s->envVolume = 1.0f - (float)s->envTime/s->envLength[2];",
+    "",
+    "    s->fphase += s->fdphase;",
+    "    s->iphase = abs((int)s->fphase);",
+    "    if (s->iphase > 1023) s->iphase = 1023;",
+    "",
+    "    if (s->flthpd != 0.0f)",
+    "    {",
+    "        s->flthp *= s->flthpd;",
+    "        if (s->flthp < 0.00001f) s->flthp = 0.00001f;",
+    "        if (s->flthp > 0.1f) s->flthp = 0.1f;",
+    "    }",
+    "",
+    "    float ssample = 0.0f;",
+    "",
+    "    for (int si = 0; si < 8; si++)     // Supersampling x8",
+    "    {",
+    "        float sample = 0.0f;",
+    "        s->phase++;",
+    "        if (s->phase >= s->period)",
+    "        {",
+    "            s->phase %= s->period;",
+    "            if (p->waveType == 3) for (int i = 0; i < 32; i++) s->noise[i] = RfxSynthRand(s, 2.0f) - 1.0f;",
+    "        }",
+    "",
+    "        float fp = (float)s->phase/s->period;",
+    "",
+    "        switch (p->waveType)",
+    "        {",
+    "            case 0: sample = (fp < s->squareDuty)? 0.5f : -0.5f; break;",
+    "            case 1: sample = 1.0f - fp*2; break;",
+    "            case 2: sample = sinf(fp*2*3.14159265358979323846f); break;",
+    "            case 3: sample = s->noise[s->phase*32/s->period]; break;",
+    "            default: break;",
+    "        }",
+    "",
+    "        float pp = s->fltp;         // LP filter",
+    "        s->fltw *= s->fltwd;",
+    "        if (s->fltw < 0.0f) s->fltw = 0.0f;",
+    "        if (s->fltw > 0.1f) s->fltw = 0.1f;",
+    "        if (p->lpfCutoff != 1.0f)",
+    "        {",
+    "            s->fltdp += (sample - s->fltp)*s->fltw;",
+    "            s->fltdp -= s->fltdp*s->fltdmp;",
+    "        }",
+    "        else",
+    "        {",
+    "            s->fltp = sample;",
+    "            s->fltdp = 0.0f;",
+    "        }",
+    "        s->fltp += s->fltdp;",
+    "",
+    "        s->fltphp += s->fltp - pp;  // HP filter",
+    "        s->fltphp -= s->fltphp*s->flthp;",
+    "        sample = s->fltphp;",
+    "",
+    "        s->phaser[s->ipp & 1023] = sample;     // Phaser",
+    "        sample += s->phaser[(s->ipp - s->iphase + 1024) & 1023];",
+    "        s->ipp = (s->ipp + 1) & 1023;",
+    "",
+    "        ssample += sample*s->envVolume;",
+    "    }",
+    "",
+    "    ssample = (ssample/8)*0.2f;",
+    "    if (ssample > 1.0f) ssample = 1.0f;",
+    "    if (ssample < -1.0f) ssample = -1.0f;",
+    "",
+    "    return ssample;",
+    "}",
+    "",
+    "// Generate sound (32 bit float, mono), returns number of frames generated",
+    "// NOTE: Noise uses own random state initialized with randSeed (rand() if 0), generated sounds match rfxgen output",
+    "static inline unsigned int RfxSynthGenerate(const RfxSynthParams *params, float *frames, unsigned int maxFrames)",
+    "{",
+    "    RfxSynthState s = { 0 };",
+    "    unsigned int count = 0;",
+    "",
+    "    s.p = *params;",
+    "    s.randState = (s.p.randSeed != 0)? (unsigned int)s.p.randSeed : (unsigned int)rand();",
+    "    if (s.p.minFrequency > s.p.startFrequency) s.p.minFrequency = s.p.startFrequency;",
+    "    if (s.p.slide < s.p.deltaSlide) s.p.slide = s.p.deltaSlide;",
+    "",
+    "    RfxSynthReset(&s, 0);",
+    "    while ((count < maxFrames) && s.generating) frames[count++] = RfxSynthSample(&s);",
+    "",
+    "    return count;",
+    "}",
+    "",
+    "#endif // RFXGEN_SYNTH",
+};
+
+// Write minimal generator code (dependency-free copy of wave generator)
+static void WriteSynthCode(FILE *codeFile)
+{
+    for (unsigned int i = 0; i < sizeof(rfxSynthCode)/sizeof(rfxSynthCode[0]); i++) fprintf(codeFile, "%s\n", rfxSynthCode[i]);
+}
+
+// Export wave parameters as .c code file with a specialized generation function
+// NOTE: Parameters derived values are computed here and written as exact literals,
+// disabled effects and unused waveforms are removed, frame count is fixed, so compiler
+// can fold constants and remove branches; output matches GenerateWave() with same math library
+static bool ExportWaveParamsFunction(WaveParams params, const char *fileName)
+{
+    bool success = false;
+
+    // Wave is generated once to get frame count, generation loop length is fixed
+    unsigned int frameCount = 0;
+    float *data = GenerateWave(params, &frameCount);
+    RFXGEN_FREE(data);
+
+    if (frameCount == 0) return success;
+
+    // Get generator initial state (validated parameters and derived values)
+    WaveGenerator generator = LoadWaveGenerator(params);
+    if (!IsWaveGeneratorValid(generator)) return success;
+
+    const WaveGeneratorState *state = (const WaveGeneratorState *)generator.state;
+    const WaveParams *p = &state->params;
+
+    char varFileName[256] = { 0 };
+    SetCodeVarName(varFileName, fileName);
+
+    // Effects enabled, matching generator conditions
+    bool repeat = (state->repeatLimit != 0);
+    bool arpeggio = (state->arpeggioLimit != 0) && (state->arpeggioModulation != 1.0);
+    bool vibrato = (state->vibratoAmplitude > 0.0f);
+    bool slideSweep = (state->fdslide != 0.0);
+    bool slide = slideSweep || (state->fslide != 1.0);
+    bool lpf = (p->lpfCutoffValue != 1.0f);
+    bool lpfSweep = lpf && (state->fltwd != 1.0f);
+    bool hpfSweep = (state->flthpd != 0.0f) && (state->flthpd != 1.0f);
+    bool dutySweep = (p->waveTypeValue == 0) && (state->squareSlide != 0.0f);
+    bool phaserSweep = (state->fdphase != 0.0f);
+    bool noise = (p->waveTypeValue == 3);
+
+    // Constant values, clamped as generator does on every sample
+    float squareDuty = state->squareDuty;
+    if (squareDuty < 0.0f) squareDuty = 0.0f;
+    if (squareDuty > 0.5f) squareDuty = 0.5f;
+
+    float fltw = state->fltw;
+    if (fltw < 0.0f) fltw = 0.0f;
+    if (fltw > 0.1f) fltw = 0.1f;
+
+    float flthp = state->flthp;
+    if (state->flthpd != 0.0f)
+    {
+        if (flthp < 0.00001f) flthp = 0.00001f;
+        if (flthp > 0.1f) flthp = 0.1f;
+    }
+
+    int iphase = (state->iphase > 1023)? 1023 : state->iphase;
+
+    // Period is constant if frequency never changes
+    bool period = !arpeggio && !slide && !vibrato && (state->fperiod <= state->fmaxperiod);
+    int periodValue = (int)(float)state->fperiod;
+    if (periodValue < 8) periodValue = 8;
+
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile != NULL)
+    {
+        const char *name = varFileName;
+
+        fprintf(codeFile, "\n//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// WaveAsFunction exporter v1.0 - Wave generation function for one sound        //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/rfxgen                        //\n");
+        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// Copyright (c) 2018-2026 raylib technologies (@raylibtech)                    //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        fprintf(codeFile, "#include <stdlib.h>     // Required for: rand(), abs()\n");
+        fprintf(codeFile, "#include <math.h>       // Required for: sinf()\n\n");
+
+        // Add wave information, generated data is always 32 bit float, mono
+        fprintf(codeFile, "// Wave data information\n");
+        fprintf(codeFile, "#define %s_FRAME_COUNT      %u\n", name, frameCount);
+        fprintf(codeFile, "#define %s_SAMPLE_RATE      %u\n", name, RFXGEN_GEN_SAMPLE_RATE);
+        fprintf(codeFile, "#define %s_SAMPLE_SIZE      %u\n", name, RFXGEN_GEN_SAMPLE_SIZE);
+        fprintf(codeFile, "#define %s_CHANNELS         %u\n\n", name, RFXGEN_GEN_CHANNELS);
+
+        fprintf(codeFile, "// Generate wave data (32 bit float, mono), frames array requires %s_FRAME_COUNT values\n", name);
+        fprintf(codeFile, "// NOTE: Floating-point contraction (FMA) must be disabled to match rfxgen output exactly\n");
+        fprintf(codeFile, "unsigned int %s_Generate(float *frames)\n{\n", name);
+
+        // Generator state, only for enabled effects
+        if (!period) fprintf(codeFile, "    double fperiod = %s;\n", TextCodeValue(state->fperiod, false));
+        if (slideSweep) fprintf(codeFile, "    double fslide = %s;\n", TextCodeValue(state->fslide, false));
+        if (repeat) fprintf(codeFile, "    int repeatTime = 0;\n");
+        if (arpeggio) fprintf(codeFile, "    int arpeggioTime = 0;\n    int arpeggioLimit = %i;\n", state->arpeggioLimit);
+        if (vibrato) fprintf(codeFile, "    float vibratoPhase = 0.0f;\n");
+        if (dutySweep) fprintf(codeFile, "    float squareDuty = %s;\n", TextCodeValue(state->squareDuty, true));
+        if (period) fprintf(codeFile, "    const int period = %i;\n", periodValue);
+        else fprintf(codeFile, "    int period = 0;\n");
+        fprintf(codeFile, "    int phase = 0;\n");
+        fprintf(codeFile, "    const int envelopeLength[3] = { %i, %i, %i };\n", state->envelopeLength[0], state->envelopeLength[1], state->envelopeLength[2]);
+        fprintf(codeFile, "    int envelopeStage = 0;\n    int envelopeTime = 0;\n    float envelopeVolume = 0.0f;\n");
+        if (phaserSweep) fprintf(codeFile, "    float fphase = %s;\n    int iphase = 0;\n", TextCodeValue(state->fphase, true));
+        if (phaserSweep || (iphase != 0)) fprintf(codeFile, "    float phaserBuffer[1024] = { 0 };\n    int ipp = 0;\n");
+        if (noise) fprintf(codeFile, "    float noiseBuffer[32] = { 0 };\n");
+        fprintf(codeFile, "    float fltp = 0.0f;\n");
+        if (lpf) fprintf(codeFile, "    float fltdp = 0.0f;\n");
+        if (lpfSweep) fprintf(codeFile, "    float fltw = %s;\n", TextCodeValue(state->fltw, true));
+        fprintf(codeFile, "    float fltphp = 0.0f;\n");
+        if (hpfSweep) fprintf(codeFile, "    float flthp = %s;\n", TextCodeValue(state->flthp, true));
+
+        // Noise buffer initialization, random state (linear congruential generator) only required for noise
+        if (noise)
+        {
+            if (p->randSeed != 0) fprintf(codeFile, "    unsigned int randState = %uu;\n\n", (unsigned int)p->randSeed);
+            else fprintf(codeFile, "    unsigned int randState = (unsigned int)rand();\n\n");
+            fprintf(codeFile, "    for (int i = 0; i < 32; i++)\n    {\n");
+            fprintf(codeFile, "        randState = randState*1664525u + 1013904223u;\n");
+            fprintf(codeFile, "        noiseBuffer[i] = (((float)((randState >> 8)%%10000 + 1)/10000.0f)*2.0f) - 1.0f;\n    }\n");
+        }
+
+        fprintf(codeFile, "\n    for (unsigned int i = 0; i < %s_FRAME_COUNT; i++)\n    {\n", name);
+
+        // Repeat: frequency, slide, duty and arpeggio restart
+        if (repeat)
+        {
+            fprintf(codeFile, "        repeatTime++;\n");
+            fprintf(codeFile, "        if (repeatTime >= %i)\n        {\n", state->repeatLimit);
+            fprintf(codeFile, "            repeatTime = 0;\n");
+            if (!period) fprintf(codeFile, "            fperiod = %s;\n", TextCodeValue(state->fperiod, false));
+            if (slideSweep) fprintf(codeFile, "            fslide = %s;\n", TextCodeValue(state->fslide, false));
+            if (dutySweep) fprintf(codeFile, "            squareDuty = %s;\n", TextCodeValue(state->squareDuty, true));
+            if (arpeggio) fprintf(codeFile, "            arpeggioTime = 0;\n            arpeggioLimit = %i;\n", state->arpeggioLimit);
+            fprintf(codeFile, "        }\n\n");
+        }
+
+        // Frequency: arpeggio, slide and vibrato
+        if (arpeggio)
+        {
+            fprintf(codeFile, "        arpeggioTime++;\n");
+            fprintf(codeFile, "        if ((arpeggioLimit != 0) && (arpeggioTime >= arpeggioLimit))\n        {\n");
+            fprintf(codeFile, "            arpeggioLimit = 0;\n            fperiod *= %s;\n        }\n\n", TextCodeValue(state->arpeggioModulation, false));
+        }
+
+        if (!period)
+        {
+            if (slideSweep) fprintf(codeFile, "        fslide += %s;\n        fperiod *= fslide;\n", TextCodeValue(state->fdslide, false));
+            else if (slide) fprintf(codeFile, "        fperiod *= %s;\n", TextCodeValue(state->fslide, false));
+            fprintf(codeFile, "        if (fperiod > %s) fperiod = %s;\n\n", TextCodeValue(state->fmaxperiod, false), TextCodeValue(state->fmaxperiod, false));
+
+            if (vibrato)
+            {
+                fprintf(codeFile, "        vibratoPhase += %s;\n", TextCodeValue(state->vibratoSpeed, true));
+                fprintf(codeFile, "        period = (int)(float)(fperiod*(1.0 + sinf(vibratoPhase)*%s));\n", TextCodeValue(state->vibratoAmplitude, true));
+            }
+            else fprintf(codeFile, "        period = (int)(float)fperiod;\n");
+
+            fprintf(codeFile, "        if (period < 8) period = 8;\n\n");
+        }
+
+        if (dutySweep)
+        {
+            fprintf(codeFile, "        squareDuty += %s;\n", TextCodeValue(state->squareSlide, true));
+            fprintf(codeFile, "        if (squareDuty < 0.0f) squareDuty = 0.0f;\n");
+            fprintf(codeFile, "        if (squareDuty > 0.5f) squareDuty = 0.5f;\n\n");
+        }
+
+        // Volume envelope
+        fprintf(codeFile, "        envelopeTime++;\n");
+        fprintf(codeFile, "        if (envelopeTime > envelopeLength[envelopeStage])\n        {\n");
+        fprintf(codeFile, "            envelopeTime = 0;\n            envelopeStage++;\n        }\n");
+        if (state->envelopeLength[0] > 0) fprintf(codeFile, "        if (envelopeStage == 0) envelopeVolume = (float)envelopeTime/%i.0f;\n", state->envelopeLength[0]);
+        if ((p->sustainPunchValue == 0.0f) && (state->envelopeLength[1] > 0)) fprintf(codeFile, "        if (envelopeStage == 1) envelopeVolume = 1.0f;\n");
+        else fprintf(codeFile, "        if (envelopeStage == 1) envelopeVolume = 1.0f + (1.0f - (float)envelopeTime/%i.0f)*2.0f*%s;\n", state->envelopeLength[1], TextCodeValue(p->sustainPunchValue, true));
+        fprintf(codeFile, "        if (envelopeStage == 2) envelopeVolume = 1.0f - (float)envelopeTime/%i.0f;\n\n", state->envelopeLength[2]);
+
+        // Phaser and high-pass filter sweeps
+        if (phaserSweep)
+        {
+            fprintf(codeFile, "        fphase += %s;\n", TextCodeValue(state->fdphase, true));
+            fprintf(codeFile, "        iphase = abs((int)fphase);\n");
+            fprintf(codeFile, "        if (iphase > 1023) iphase = 1023;\n\n");
+        }
+
+        if (hpfSweep)
+        {
+            fprintf(codeFile, "        flthp *= %s;\n", TextCodeValue(state->flthpd, true));
+            fprintf(codeFile, "        if (flthp < 0.00001f) flthp = 0.00001f;\n");
+            fprintf(codeFile, "        if (flthp > 0.1f) flthp = 0.1f;\n\n");
+        }
+
+        // Supersampling x8
+        fprintf(codeFile, "        float ssample = 0.0f;\n\n");
+        fprintf(codeFile, "        for (int si = 0; si < 8; si++)\n        {\n");
+        fprintf(codeFile, "            float sample = 0.0f;\n\n");
+        fprintf(codeFile, "            phase++;\n");
+        if (noise)
+        {
+            fprintf(codeFile, "            if (phase >= period)\n            {\n");
+            fprintf(codeFile, "                phase %%= period;\n");
+            fprintf(codeFile, "                for (int j = 0; j < 32; j++)\n                {\n");
+            fprintf(codeFile, "                    randState = randState*1664525u + 1013904223u;\n");
+            fprintf(codeFile, "                    noiseBuffer[j] = (((float)((randState >> 8)%%10000 + 1)/10000.0f)*2.0f) - 1.0f;\n                }\n");
+            fprintf(codeFile, "            }\n\n");
+        }
+        else fprintf(codeFile, "            if (phase >= period) phase %%= period;\n\n");
+
+        // Base waveform, only selected one
+        char fp[64] = "(float)phase/period";
+        if (period) sprintf(fp, "(float)phase/%i.0f", periodValue);
+
+        switch (p->waveTypeValue)
+        {
+            case 0:
+            {
+                if (dutySweep) fprintf(codeFile, "            sample = ((%s) < squareDuty)? 0.5f : -0.5f;\n", fp);
+                else fprintf(codeFile, "            sample = ((%s) < %s)? 0.5f : -0.5f;\n", fp, TextCodeValue(squareDuty, true));
+            } break;
+            case 1: fprintf(codeFile, "            sample = 1.0f - (%s)*2;\n", fp); break;
+            case 2: fprintf(codeFile, "            sample = sinf((%s)*2*3.14159265358979323846f);\n", fp); break;
+            case 3: fprintf(codeFile, "            sample = noiseBuffer[phase*32/period];\n"); break;
+            default: break;
+        }
+
+        // Low-pass filter
+        fprintf(codeFile, "\n            float pp = fltp;\n");
+        if (lpf)
+        {
+            if (lpfSweep)
+            {
+                fprintf(codeFile, "            fltw *= %s;\n", TextCodeValue(state->fltwd, true));
+                fprintf(codeFile, "            if (fltw < 0.0f) fltw = 0.0f;\n");
+                fprintf(codeFile, "            if (fltw > 0.1f) fltw = 0.1f;\n");
+                fprintf(codeFile, "            fltdp += (sample - fltp)*fltw;\n");
+            }
+            else fprintf(codeFile, "            fltdp += (sample - fltp)*%s;\n", TextCodeValue(fltw, true));
+            fprintf(codeFile, "            fltdp -= fltdp*%s;\n", TextCodeValue(state->fltdmp, true));
+            fprintf(codeFile, "            fltp += fltdp;\n\n");
+        }
+        else fprintf(codeFile, "            fltp = sample + 0.0f;\n\n");
+
+        // High-pass filter
+        fprintf(codeFile, "            fltphp += fltp - pp;\n");
+        if (hpfSweep) fprintf(codeFile, "            fltphp -= fltphp*flthp;\n");
+        else fprintf(codeFile, "            fltphp -= fltphp*%s;\n", TextCodeValue(flthp, true));
+        fprintf(codeFile, "            sample = fltphp;\n\n");
+
+        // Phaser, zero offset adds sample to itself
+        if (phaserSweep || (iphase != 0))
+        {
+            fprintf(codeFile, "            phaserBuffer[ipp & 1023] = sample;\n");
+            if (phaserSweep) fprintf(codeFile, "            sample += phaserBuffer[(ipp - iphase + 1024) & 1023];\n");
+            else fprintf(codeFile, "            sample += phaserBuffer[(ipp - %i + 1024) & 1023];\n", iphase);
+            fprintf(codeFile, "            ipp = (ipp + 1) & 1023;\n\n");
+        }
+        else fprintf(codeFile, "            sample += sample;\n\n");
+
+        fprintf(codeFile, "            ssample += sample*envelopeVolume;\n");
+        fprintf(codeFile, "        }\n\n");
+
+        fprintf(codeFile, "        ssample = (ssample/8)*0.2f;\n");
+        fprintf(codeFile, "        if (ssample > 1.0f) ssample = 1.0f;\n");
+        fprintf(codeFile, "        if (ssample < -1.0f) ssample = -1.0f;\n\n");
+        fprintf(codeFile, "        frames[i] = ssample;\n");
+        fprintf(codeFile, "    }\n\n");
+        fprintf(codeFile, "    return %s_FRAME_COUNT;\n}\n", name);
+
+        success = (ferror(codeFile) == 0);
+        fclose(codeFile);
+    }
+
+    UnloadWaveGenerator(generator);
+
+    return success;
+}
+
+// Get number as code literal text, exact value: float (9 digits, f suffix) or double (17 digits)
+// NOTE: Text is stored in static buffers, valid for 4 consecutive calls
+static const char *TextCodeValue(double value, bool isFloat)
+{
+    static char buffers[4][32] = { 0 };
+    static int index = 0;
+
+    char *text = buffers[index];
+    index = (index + 1)%4;
+
+    sprintf(text, isFloat? "%.9g" : "%.17g", value);
+    if (strpbrk(text, ".e") == NULL) strcat(text, ".0");
+    if (isFloat) strcat(text, "f");
+
+    return text;
+}
+
+// Get name hash (FNV-1a, 32 bit)
+static unsigned int RfxHashName(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (const unsigned char *c = (const unsigned char *)name; *c != '\0'; c++) hash = (hash ^ *c)*16777619u;
+
+    return hash;
+}
+
+// Load bank data with header, hash table and names, entries data is left empty
+// NOTE: Entries are placed after hash table, extraSize bytes are reserved after entries,
+// names are placed at the end, returns NULL if names are duplicated or data can not be allocated
+static unsigned char *LoadBankData(const char *signature, unsigned int entrySize, const char **names, unsigned int count, unsigned int extraSize, unsigned int *entriesOffset, unsigned int *dataSize)
+{
+    // Hash table slots count: power of 2, at least twice the sounds count
+    unsigned int slotCount = 2;
+    while (slotCount < count*2) slotCount *= 2;
+
+    unsigned int hashOffset = 32;
+    unsigned int namesOffset = 0;
+
+    *entriesOffset = RFXGEN_BANK_ALIGN(hashOffset + slotCount*8);
+    namesOffset = RFXGEN_BANK_ALIGN(*entriesOffset + count*entrySize + extraSize);
+    *dataSize = namesOffset + count*4;
+
+    for (unsigned int i = 0; i < count; i++) *dataSize += (unsigned int)strlen(names[i]) + 1;
+
+    unsigned char *data = (unsigned char *)RFXGEN_CALLOC(*dataSize, 1);
+    unsigned int namePosition = namesOffset + count*4;
+
+    if (data == NULL) return NULL;
+
+    memcpy(data, signature, 4);
+    WriteU16LE(data + 4, 100);
+    WriteU16LE(data + 6, (unsigned short)entrySize);
+    WriteU32LE(data + 8, count);
+    WriteU32LE(data + 12, slotCount);
+    WriteU32LE(data + 16, hashOffset);
+    WriteU32LE(data + 20, *entriesOffset);
+    WriteU32LE(data + 24, namesOffset);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int hash = RfxHashName(names[i]);
+        unsigned int slot = hash & (slotCount - 1);
+
+        // Look for a free slot, checking for duplicated names
+        while (ReadU32LE(data + hashOffset + slot*8 + 4) != 0)
+        {
+            unsigned int id = ReadU32LE(data + hashOffset + slot*8 + 4) - 1;
+
+            if ((ReadU32LE(data + hashOffset + slot*8) == hash) && (strcmp(names[id], names[i]) == 0))
+            {
+                RFXGEN_LOG("WAVE: Bank sound name duplicated: %s\n", names[i]);
+                RFXGEN_FREE(data);
+                return NULL;
+            }
+
+            slot = (slot + 1) & (slotCount - 1);
+        }
+
+        WriteU32LE(data + hashOffset + slot*8, hash);
+        WriteU32LE(data + hashOffset + slot*8 + 4, i + 1);
+
+        WriteU32LE(data + namesOffset + i*4, namePosition);
+        strcpy((char *)data + namePosition, names[i]);
+        namePosition += (unsigned int)strlen(names[i]) + 1;
+    }
+
+    return data;
+}
+
+// Save bank data to file
+static bool SaveBankData(const unsigned char *data, unsigned int dataSize, const char *fileName)
+{
+    bool success = false;
+    FILE *bankFile = fopen(fileName, "wb");
+
+    if (bankFile != NULL)
+    {
+        success = (fwrite(data, 1, dataSize, bankFile) == dataSize);
+        if (fclose(bankFile) != 0) success = false;
+    }
+
+    return success;
+}
+
+// Check bank data header and sections bounds, names data must be NULL terminated
+static bool IsBankDataValid(const unsigned char *data, unsigned int dataSize, const char *signature, unsigned int entrySize)
+{
+    if ((dataSize < 32) || (memcmp(data, signature, 4) != 0) || ((data[4] | (data[5] << 8)) != 100) || ((unsigned int)(data[6] | (data[7] << 8)) != entrySize)) return false;
+
+    unsigned int count = ReadU32LE(data + 8);
+    unsigned int slotCount = ReadU32LE(data + 12);
+    unsigned int hashOffset = ReadU32LE(data + 16);
+    unsigned int entriesOffset = ReadU32LE(data + 20);
+    unsigned int namesOffset = ReadU32LE(data + 24);
+
+    bool valid = (count > 0) && (slotCount >= count) && ((slotCount & (slotCount - 1)) == 0) &&
+                 ((entriesOffset & 15) == 0) && (hashOffset <= dataSize) && (slotCount <= (dataSize - hashOffset)/8) &&
+                 (entriesOffset <= dataSize) && (count <= (dataSize - entriesOffset)/entrySize) &&
+                 (namesOffset <= dataSize) && (count <= (dataSize - namesOffset)/4) && (data[dataSize - 1] == '\0');
+
+    for (unsigned int i = 0; valid && (i < count); i++) valid = (ReadU32LE(data + namesOffset + i*4) < dataSize);
+
+    return valid;
+}
+
+// Get bank sound id by name (hash table lookup), -1 if not found
+// NOTE: One name comparison on average
+static int GetBankSoundId(const unsigned char *data, const char *name)
+{
+    if (name == NULL) return -1;
+
+    unsigned int count = ReadU32LE(data + 8);
+    unsigned int slotCount = ReadU32LE(data + 12);
+    const unsigned char *table = data + ReadU32LE(data + 16);
+    unsigned int hash = RfxHashName(name);
+    unsigned int slot = hash & (slotCount - 1);
+
+    for (unsigned int i = 0; i < slotCount; i++)
+    {
+        unsigned int id = ReadU32LE(table + slot*8 + 4);
+
+        if (id == 0) break;     // Empty slot, name not in bank
+        if ((id <= count) && (ReadU32LE(table + slot*8) == hash) && (strcmp(GetBankSoundName(data, id - 1), name) == 0)) return (int)(id - 1);
+
+        slot = (slot + 1) & (slotCount - 1);
+    }
+
+    return -1;
+}
+
+// Get bank sound name by id
+static const char *GetBankSoundName(const unsigned char *data, int id)
+{
+    if ((id < 0) || ((unsigned int)id >= ReadU32LE(data + 8))) return NULL;
+
+    return (const char *)data + ReadU32LE(data + ReadU32LE(data + 24) + id*4);
+}
+
+// Map file data into memory (read-only)
+// NOTE: With RFXGEN_NO_MMAP file data is loaded into memory with one read
+static void *RfxMapFile(const char *fileName, unsigned int *dataSize)
+{
+    void *data = NULL;
+
+    *dataSize = 0;
+
+#if defined(RFXGEN_NO_MMAP)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = RFXGEN_CALLOC(size, 1);
+
+            if (fread(data, 1, size, file) == (size_t)size) *dataSize = (unsigned int)size;
+            else
+            {
+                RFXGEN_FREE(data);
+                data = NULL;
+            }
+        }
+
+        fclose(file);
+    }
+#elif defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);   // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)(long long)-1)      // INVALID_HANDLE_VALUE
+    {
+        unsigned long size = GetFileSize(file, NULL);
+        void *mapping = ((size > 0) && (size != 0xffffffff))? CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL) : NULL;    // PAGE_READONLY
+
+        if (mapping != NULL)
+        {
+            data = MapViewOfFile(mapping, 0x0004, 0, 0, 0);     // FILE_MAP_READ
+            if (data != NULL) *dataSize = (unsigned int)size;
+            CloseHandle(mapping);
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int file = open(fileName, O_RDONLY);
+
+    if (file >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(file, &info) == 0) && (info.st_size > 0))
+        {
+            data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+            if (data != MAP_FAILED) *dataSize = (unsigned int)info.st_size;
+            else data = NULL;
+        }
+
+        close(file);
+    }
+#endif
+
+    return data;
+}
+
+// Unmap file data
+static void RfxUnmapFile(void *data, unsigned int dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(RFXGEN_NO_MMAP)
+    RFXGEN_FREE(data);
+#elif defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap(data, dataSize);
+#endif
+}
+
+// Load wave parameters from .rfx file with one read, returns WaveParamsLoadError
+static int LoadWaveParamsFile(const char *fileName, WaveParams *params)
+{
+    // rFX File Structure (.rfx)
+    // ------------------------------------------------------
+    // Offset | Size  | Type       | Description
+    // ------------------------------------------------------
+    // 0      | 4     | char       | Signature: "rFX "
+    // 4      | 2     | short      | Version: 200
+    // 6      | 2     | short      | Data length: 96 bytes
+    // 8      | 96    | WaveParams | Wave parameters
+    // ------------------------------------------------------
+    unsigned char data[RFXGEN_PARAMS_FILE_SIZE] = { 0 };
+    FILE *rfxFile = fopen(fileName, "rb");
+
+    if (rfxFile == NULL) return RFXGEN_LOAD_ERROR_OPEN;
+
+    // Unbuffered stream, file is read with one system call
+    setvbuf(rfxFile, NULL, _IONBF, 0);
+    size_t size = fread(data, 1, RFXGEN_PARAMS_FILE_SIZE, rfxFile);
+    fclose(rfxFile);
+
+    // Check for valid .rfx file (FormatCC)
+    if ((size >= 4) && (memcmp(data, "rFX ", 4) != 0)) return RFXGEN_LOAD_ERROR_FORMAT;
+    if (size < 8) return RFXGEN_LOAD_ERROR_READ;
+    if ((data[4] | (data[5] << 8)) != 200) return RFXGEN_LOAD_ERROR_VERSION;
+    if ((data[6] | (data[7] << 8)) != sizeof(WaveParams)) return RFXGEN_LOAD_ERROR_FORMAT;
+    if (size < RFXGEN_PARAMS_FILE_SIZE) return RFXGEN_LOAD_ERROR_READ;
+
+    RFXGEN_MEMCPY(params, data + 8, sizeof(WaveParams));
+
+    return RFXGEN_LOAD_SUCCESS;
+}
+
+// Load wave parameters files range (thread function)
+// NOTE: Task uses a list to define the range, errors are counted into task list
+static void LoadWaveParamsJobs(void *data)
+{
+    WaveParamsList *task = (WaveParamsList *)data;
+
+    for (unsigned int i = 0; i < task->count; i++)
+    {
+        task->errors[i] = (unsigned char)LoadWaveParamsFile(task->fileNames[i], &task->params[i]);
+        if (task->errors[i] != RFXGEN_LOAD_SUCCESS) task->errorCount++;
+    }
+}
+
+// Compare files paths, used to sort directory files
+static int RfxCompareFiles(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+// Load directory files paths with extension, sorted by name (not recursive)
+// NOTE: Returns NULL if directory can not be opened, paths include directory path
+static char **RfxLoadDirectoryFiles(const char *dirPath, const char *extension, unsigned int *count)
+{
+    unsigned int capacity = 256;
+    char **files = NULL;
+
+    *count = 0;
+
+#if defined(_WIN32)
+    char pattern[1024] = { 0 };
+    struct _finddata_t entry = { 0 };
+
+    snprintf(pattern, 1024, "%s/*%s", dirPath, extension);
+    intptr_t handle = _findfirst(pattern, &entry);
+
+    // NOTE: No matching files also returns -1, check for directory
+    if (handle == -1)
+    {
+        snprintf(pattern, 1024, "%s/*", dirPath);
+        handle = _findfirst(pattern, &entry);
+        if (handle == -1) return NULL;
+
+        _findclose(handle);
+        return (char **)RFXGEN_CALLOC(1, sizeof(char *));
+    }
+
+    files = (char **)RFXGEN_CALLOC(capacity, sizeof(char *));
+
+    do
+    {
+        const char *fileName = entry.name;
+#else
+    DIR *dir = opendir(dirPath);
+    if (dir == NULL) return NULL;
+
+    files = (char **)RFXGEN_CALLOC(capacity, sizeof(char *));
+
+    for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir))
+    {
+        const char *fileName = entry->d_name;
+#endif
+        if ((strlen(fileName) <= strlen(extension)) || !RFXGEN_ISFILEEXTENSION(fileName, extension)) continue;
+
+        if (*count == capacity)
+        {
+            char **grown = (char **)RFXGEN_CALLOC(capacity*2, sizeof(char *));
+            RFXGEN_MEMCPY(grown, files, capacity*sizeof(char *));
+            RFXGEN_FREE(files);
+            files = grown;
+            capacity *= 2;
+        }
+
+        size_t length = strlen(dirPath) + strlen(fileName) + 2;
+        files[*count] = (char *)RFXGEN_CALLOC(length, 1);
+        snprintf(files[*count], length, "%s/%s", dirPath, fileName);
+        (*count)++;
+#if defined(_WIN32)
+    } while (_findnext(handle, &entry) == 0);
+
+    _findclose(handle);
+#else
+    }
+
+    closedir(dir);
+#endif
+
+    qsort(files, *count, sizeof(char *), RfxCompareFiles);
+
+    return files;
+}
+
+// Unload directory files paths
+static void RfxUnloadDirectoryFiles(char **files, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++) RFXGEN_FREE(files[i]);
+    RFXGEN_FREE(files);
+}
+
+// Get number of logical processors available
+static int RfxGetProcessorCount(void)
+{
+    int count = 1;
+
+#if !defined(RFXGEN_NO_THREADS)
+    #if defined(_WIN32)
+        count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+    #else
+        count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+#endif
+
+    if (count < 1) count = 1;
+
+    return count;
+}
+
+#if !defined(RFXGEN_NO_THREADS)
+// Thread function data, required to adapt function signature to platform
+typedef struct RfxThreadData {
+    void (*func)(void *);
+    void *arg;
+} RfxThreadData;
+
+#if defined(_WIN32)
+static unsigned long __stdcall RfxThreadMain(void *data)
+#else
+static void *RfxThreadMain(void *data)
+#endif
+{
+    RfxThreadData thread = *(RfxThreadData *)data;
+    RFXGEN_FREE(data);
+
+    thread.func(thread.arg);
+
+    return 0;
+}
+
+// Create thread running func(arg)
+static bool RfxThreadCreate(RfxThread *thread, void (*func)(void *), void *arg)
+{
+    bool success = false;
+    RfxThreadData *data = (RfxThreadData *)RFXGEN_CALLOC(1, sizeof(RfxThreadData));
+
+    data->func = func;
+    data->arg = arg;
+
+#if defined(_WIN32)
+    *thread = CreateThread(NULL, 0, RfxThreadMain, data, 0, NULL);
+    success = (*thread != NULL);
+#else
+    success = (pthread_create(thread, NULL, RfxThreadMain, data) == 0);
+#endif
+
+    if (!success) RFXGEN_FREE(data);
+
+    return success;
+}
+
+// Wait for thread to finish
+static void RfxThreadJoin(RfxThread thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, 0xffffffff);    // INFINITE
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+// Init semaphore with initial count
+// NOTE: Semaphores functions are inline, not used by library itself (no unused functions warnings)
+static inline void RfxSemaphoreInit(RfxSemaphore *semaphore, int count)
+{
+#if defined(_WIN32)
+    *semaphore = CreateSemaphoreA(NULL, count, 0x7fffffff, NULL);
+#else
+    pthread_mutex_init(&semaphore->mutex, NULL);
+    pthread_cond_init(&semaphore->cond, NULL);
+    semaphore->count = count;
+#endif
+}
+
+// Increment semaphore count
+static inline void RfxSemaphorePost(RfxSemaphore *semaphore)
+{
+#if defined(_WIN32)
+    ReleaseSemaphore(*semaphore, 1, NULL);
+#else
+    pthread_mutex_lock(&semaphore->mutex);
+    semaphore->count++;
+    pthread_cond_signal(&semaphore->cond);
+    pthread_mutex_unlock(&semaphore->mutex);
+#endif
+}
+
+// Wait until count > 0 and decrement it
+static inline void RfxSemaphoreWait(RfxSemaphore *semaphore)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(*semaphore, 0xffffffff);    // INFINITE
+#else
+    pthread_mutex_lock(&semaphore->mutex);
+    while (semaphore->count <= 0) pthread_cond_wait(&semaphore->cond, &semaphore->mutex);
+    semaphore->count--;
+    pthread_mutex_unlock(&semaphore->mutex);
+#endif
+}
+
+// Unload semaphore
+static inline void RfxSemaphoreUnload(RfxSemaphore *semaphore)
+{
+#if defined(_WIN32)
+    CloseHandle(*semaphore);
+#else
+    pthread_mutex_destroy(&semaphore->mutex);
+    pthread_cond_destroy(&semaphore->cond);
+#endif
 }
+#endif // !RFXGEN_NO_THREADS
 
 #endif      // RFXGEN_IMPLEMENTATION
@@ -0,0 +1,57 @@
+/*******************************************************************************************
+*
+*   rFXGen CLI - Headless command-line sounds generator
+*
+*   Same command-line interface than rFXGen tool but without GUI, audio device or raylib
+*   dependencies, useful for build pipelines and servers
+*
+*   LIMITATIONS:
+*       - Input files supported: .rfx, .wav, .qoa (no .ogg, .flac, .mp3 decoding)
+*       - No sound playing (--play not available)
+*
+*   DEPENDENCIES:
+*       rfxgen.h        - Sound generation and wave export (.wav, .qoa, .raw, .h)
+*       rfxgen_cli.h    - Command-line interface
+*
+*   BUILDING:
+*     - Linux/macOS:    gcc -o rfxgen_cli rfxgen_cli.c -std=c99 -lm -lpthread
+*     - Windows:        cl rfxgen_cli.c
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#define TOOL_NAME               "rFXGen"
+#define TOOL_VERSION            "5.0"
+#define TOOL_DESCRIPTION        "A simple and easy-to-use fx sounds generator"
+
+#define RFXGEN_IMPLEMENTATION
+#include "rfxgen.h"                         // Sound generation library
+
+#define RFXGEN_CLI_IMPLEMENTATION
+#include "rfxgen_cli.h"                     // Command-line interface: ProcessCommandLine()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    return ProcessCommandLine(argc, argv);
+}
@@ -0,0 +1,1544 @@
+/*******************************************************************************************
+*
+*   rFXGen Command-Line Interface
+*
+*   MODULE USAGE:
+*       #define RFXGEN_CLI_IMPLEMENTATION
+*       #include "rfxgen_cli.h"
+*
+*       ProcessCommandLine(argc, argv);
+*
+*   CONFIGURATION:
+*       #define RFXGEN_CLI_USE_RAYLIB
+*           Use raylib for audio files loading (.ogg, .flac, .mp3) and playing (--play)
+*           NOTE: If not defined, only rfxgen.h is required (headless command-line tool)
+*           NOTE: .wav and .qoa files are always decoded progressively (chunks), no raylib required
+*
+*       #define RFXGEN_NO_THREADS
+*           Disable multithreading, audio files decoding and encoding run sequentially
+*           NOTE: Disabled by default on web platform
+*
+*   DEPENDENCIES:
+*       rfxgen.h    - Sound generation and wave export, implementation must be included before this module
+*       raylib      - Audio loading and playing, only required with RFXGEN_CLI_USE_RAYLIB
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RFXGEN_CLI_H
+#define RFXGEN_CLI_H
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void ShowCommandLineInfo(void);                     // Show command line usage info
+int ProcessCommandLine(int argc, char *argv[]);     // Process command line input, returns exit status
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RFXGEN_CLI_H
+
+/***********************************************************************************
+*
+*   RFXGEN_CLI IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(RFXGEN_CLI_IMPLEMENTATION)
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    #include "raylib.h"
+#endif
+
+#include <stdio.h>                  // Required for: printf(), fprintf(), sscanf(), FILE, fopen(), fread(), fclose()
+#include <string.h>                 // Required for: strcpy(), strcmp(), memcmp()
+
+// NOTE: RFXGEN_NO_THREADS is defined by rfxgen.h on web platform
+#if !defined(RFXGEN_NO_THREADS) && !defined(_WIN32)
+    #include <pthread.h>            // Required for: pthread_mutex_t, pthread_cond_t
+#endif
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    #if defined(_WIN32)
+        #include <conio.h>          // Required for: _kbhit(), _getch() [Windows only, no stardard library]
+    #else
+        #include <termios.h>        // Required for: tcgetattr(), tcsetattr()
+        #include <unistd.h>         // Required for: read(), isatty()
+        #include <poll.h>           // Required for: poll()
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef TOOL_NAME
+    #define TOOL_NAME           "rFXGen"
+#endif
+#ifndef TOOL_VERSION
+    #define TOOL_VERSION        "5.0"
+#endif
+#ifndef TOOL_DESCRIPTION
+    #define TOOL_DESCRIPTION    "A simple and easy-to-use fx sounds generator"
+#endif
+
+// Simple log system to avoid printf() calls if required
+// NOTE: Avoiding those calls, also avoids const strings memory usage
+#if !defined(RFXGEN_CLI_LOG)
+    #if defined(_DEBUG)
+        #define RFXGEN_CLI_LOG(...) printf(__VA_ARGS__)
+    #else
+        #define RFXGEN_CLI_LOG(...) do { } while (0)
+    #endif
+#endif
+
+// Audio files transcoding: decoding chunk size and number of chunks in flight
+// NOTE: Memory usage is fixed, independent of audio file length
+#define RFXGEN_CLI_CHUNK_FRAMES     16384   // Frames per decoded chunk
+#define RFXGEN_CLI_CHUNK_COUNT          4   // Chunks shared between decoder and encoder threads
+
+#define RFXGEN_CLI_MAX_OUTPUTS         16   // Max output files per input (--output)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Output file target, one input can be exported to several targets
+typedef struct OutputTarget {
+    char fileName[512];             // Output file name
+    int sampleRate;                 // Output sample rate
+    int sampleSize;                 // Output sample size
+    int channels;                   // Output channels
+    bool formatDefined;             // Format defined for this output (--format following --output)
+} OutputTarget;
+
+// Audio reader, audio data is decoded or generated progressively (chunks)
+typedef struct AudioReader {
+    unsigned int frameCount;        // Total number of frames (0 if unknown)
+    unsigned int sampleRate;        // Frequency (samples per second)
+    unsigned int sampleSize;        // Source bit depth: 4 (ADPCM), 8, 16, 24, 32
+    unsigned int channels;          // Number of channels
+    int fileType;                   // File type: 0-WAV (PCM), 1-WAV (float), 2-QOA, 3-Loaded wave (raylib), 4-Generated wave (.rfx, preset), 5-WAV (IMA-ADPCM)
+    FILE *file;                     // File handle
+    unsigned int position;          // Current frame position
+    unsigned char *buffer;          // Encoded data buffer (WAV samples block, QOA frame, ADPCM block)
+    unsigned int blockAlign;        // ADPCM: block size in bytes
+    short *samples;                 // QOA, ADPCM: decoded frame/block samples
+    unsigned int samplesCount;      // QOA, ADPCM: decoded frame/block length
+    unsigned int samplesPosition;   // QOA, ADPCM: current frame/block position
+    WaveBuffer wave;                // Fully loaded wave (raylib supported formats)
+    WaveGenerator generator;        // Wave generator (sound parameters)
+} AudioReader;
+
+// Audio frames converter, channels mixing and sample rate conversion (linear interpolation)
+// NOTE: Conversion state is carried between chunks
+typedef struct AudioConverter {
+    unsigned int inChannels;        // Input channels
+    unsigned int outChannels;       // Output channels (1 or 2)
+    unsigned int inSampleRate;      // Input sample rate
+    unsigned int outSampleRate;     // Output sample rate
+    unsigned long long outPosition; // Next output frame index
+    unsigned long long inPosition;  // Input frames consumed before current chunk
+    float lastFrame[2];             // Last input frame of previous chunk (channels converted)
+} AudioConverter;
+
+// Audio transcoding pipeline, decoder thread fills chunks consumed by encoder
+typedef struct TranscodePipeline {
+    AudioReader *reader;
+    float *chunks[RFXGEN_CLI_CHUNK_COUNT];
+    unsigned int chunkFrames[RFXGEN_CLI_CHUNK_COUNT];
+    bool abort;                     // Encoder request to stop decoding (write failed)
+#if !defined(RFXGEN_NO_THREADS)
+    RfxSemaphore emptyChunks;
+    RfxSemaphore filledChunks;
+#endif
+} TranscodePipeline;
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+// CLI player stream update time in milliseconds, also max wait time for key input
+// NOTE: It must be lower than the audio stream buffer length to avoid audio gaps
+#define RFXGEN_CLI_PLAYER_UPDATE_TIME   10
+
+#if defined(_WIN32) && !defined(_WINDOWS_)
+// Console input wait functions (kernel32.lib)
+// NOTE: Declared manually to avoid including windows.h, that conflicts with raylib
+void *__stdcall GetStdHandle(unsigned long nStdHandle);
+unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+void __stdcall Sleep(unsigned long dwMilliseconds);
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadAudioReader(AudioReader *reader, const char *fileName);        // Load audio file reader (.rfx, .wav, .qoa, [.ogg, .flac, .mp3])
+static bool LoadAudioGenerator(AudioReader *reader, WaveParams params);       // Load audio reader for wave generated from parameters
+static unsigned int ReadAudioFrames(AudioReader *reader, float *frames, unsigned int frameCount); // Read float frames (channels interleaved), returns frames read
+static void UnloadAudioReader(AudioReader *reader);                         // Unload audio file reader
+static WaveBuffer LoadAudioFileBuffer(const char *fileName);                // Load full audio file into wave buffer (32 bit float)
+
+static unsigned int ConvertAudioFrames(AudioConverter *converter, const float *frames, unsigned int frameCount, float *output); // Convert chunk frames, returns output frames
+static unsigned int FlushAudioConverter(AudioConverter *converter, float *output); // Get remaining output frames at stream end
+
+static bool TranscodeAudio(AudioReader *reader, const OutputTarget *outputs, int outputCount); // Transcode audio reader data to all outputs with fixed memory
+static bool ExportWaveTargets(WaveBuffer wave, const OutputTarget *outputs, int outputCount); // Export wave to all outputs, sharing conversions
+static bool PackWaveBank(const char *fileName, const char **inputs, int inputCount, int quantBits, int sampleRate, int sampleSize, int channels); // Pack .rfx files into wave bank (.rfxb, .rfxp)
+#if !defined(RFXGEN_NO_THREADS)
+static void DecodeAudioChunks(void *data);                                          // Decode audio file chunks into pipeline (decoder thread)
+#endif
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+static void WaitMusicPlayer(Music music);       // Wait while music is playing, updating stream and progress bar
+static void PlayMusicCLI(const char *fileName); // Play provided audio file through CLI (streamed)
+static int WaitKeyPressed(int ms);              // Wait for a key pressed up to ms milliseconds, returns -1 on timeout
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Show command line usage info
+void ShowCommandLineInfo(void)
+{
+    printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
+    printf("//                                                                              //\n");
+    printf("// %s v%s - %s                   //\n", TOOL_NAME, TOOL_VERSION, TOOL_DESCRIPTION);
+#if defined(RFXGEN_CLI_USE_RAYLIB) && defined(RAYGUI_VERSION)
+    printf("// powered by raylib v%s and raygui v%s                               //\n", RAYLIB_VERSION, RAYGUI_VERSION);
+#else
+    printf("// headless command-line tool, powered by rfxgen.h                              //\n");
+#endif
+    printf("// more info and bugs-report: github.com/raysan5/rfxgen                         //\n");
+    printf("//                                                                              //\n");
+    printf("// Copyright (c) 2014-2026 raylib technologies (@raylibtech)                    //\n");
+    printf("//                                                                              //\n");
+    printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    printf("USAGE:\n\n");
+    printf("    > rfxgen [--help] --input <filename.ext> [--output <filename.ext>]\n");
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    printf("             [--format <sample_rate>,<sample_size>,<channels>] [--play <filename.ext>]\n");
+#else
+    printf("             [--format <sample_rate>,<sample_size>,<channels>]\n");
+#endif
+
+    printf("\nOPTIONS:\n\n");
+    printf("    -h, --help                      : Show tool version and command line usage help\n\n");
+    printf("    -i, --input <filename.ext>      : Define input file.\n");
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    printf("                                      Supported extensions: .rfx, .wav, .qoa, .ogg, .flac, .mp3\n\n");
+#else
+    printf("                                      Supported extensions: .rfx, .wav, .qoa\n\n");
+#endif
+    printf("    -o, --output <filename.ext>     : Define output file.\n");
+    printf("                                      Supported extensions: .wav, .qoa, .raw, .h, .bin, .c\n");
+    printf("                                      NOTE: .bin exports raw data and a .h header to embed it\n");
+    printf("                                      NOTE: .c exports a generation function for the sound\n");
+    printf("                                      (constants folded, requires .rfx or preset)\n");
+    printf("                                      NOTE: If not specified, defaults to: output.wav\n");
+    printf("                                      NOTE: Several outputs can be defined (max %i), sound is\n", RFXGEN_CLI_MAX_OUTPUTS);
+    printf("                                      generated once and exported to all of them\n\n");
+    printf("    -c, --code <filename.h>         : Export sound parameters and a minimal generator as code file,\n");
+    printf("                                      sound is synthesized at first use (requires .rfx or preset).\n\n");
+    printf("    -g, --generate <preset>            : Generate file based on the preset.\n");
+    printf("                                      Supported presets: coin, laser, explosion, powerup, hit, jump, blip\n");
+    printf("    -f, --format <sample_rate>,<sample_size>,<channels>\n");
+    printf("                                    : Define output wave format. Comma separated values.\n");
+    printf("                                      Supported values:\n");
+    printf("                                          Sample rate:      22050, 44100\n");
+    printf("                                          Sample size:      4 (IMA-ADPCM, .wav only), 8, 16, 32\n");
+    printf("                                          Channels:         1 (mono), 2 (stereo)\n");
+    printf("                                      NOTE: If not specified, defaults to: 44100, 16, 1\n");
+    printf("                                      NOTE: Format applies to the preceding output, otherwise it\n");
+    printf("                                      sets the format for all outputs without one\n");
+    printf("                                      (ignored after a .c output, code has no format)\n\n");
+    printf("    -b, --bank <filename.ext> <filename.rfx> [<filename.rfx> ...]\n");
+    printf("                                    : Pack provided sounds into one bank file.\n");
+    printf("                                      Supported extensions: .rfxb (parameters), .rfxp (pre-rendered)\n");
+    printf("                                      NOTE: Sounds are named as files, without path and extension\n");
+    printf("                                      NOTE: Pre-rendered sounds use the default --format\n\n");
+    printf("    -q, --quantize <bits>           : Store .rfxb bank sounds parameters encoded quantized.\n");
+    printf("                                      Supported values: 8, 12, 16 (bits per parameter)\n\n");
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    printf("    -p, --play <filename.ext>       : Play provided sound.\n");
+    printf("                                      Supported extensions: .wav, .qoa, .ogg, .flac, .mp3\n");
+#endif
+
+    printf("\nEXAMPLES:\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.wav\n");
+    printf("        Process <sound.rfx> to generate <sound.wav> at 44100 Hz, 32 bit, Mono\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.raw --format 22050,16,2\n");
+    printf("        Process <sound.rfx> to generate <jump.raw> at 22050 Hz, 16 bit, Stereo\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.wav --output jump.qoa --output jump22.wav --format 22050,8,1\n");
+    printf("        Process <sound.rfx> once to generate <jump.wav>, <jump.qoa> at 44100 Hz, 16 bit, Mono\n");
+    printf("        and <jump22.wav> at 22050 Hz, 8 bit, Mono\n\n");
+    printf("    > rfxgen --bank sounds.rfxb coin.rfx jump.rfx laser.rfx\n");
+    printf("        Pack <coin.rfx>, <jump.rfx> and <laser.rfx> into <sounds.rfxb> bank (coin, jump, laser)\n\n");
+    printf("    > rfxgen --quantize 12 --bank sounds.rfxb coin.rfx jump.rfx laser.rfx\n");
+    printf("        Pack <coin.rfx>, <jump.rfx> and <laser.rfx> into <sounds.rfxb> bank, parameters quantized to 12 bit\n\n");
+    printf("    > rfxgen --format 22050,16,1 --bank sounds.rfxp coin.rfx jump.rfx laser.rfx\n");
+    printf("        Render <coin.rfx>, <jump.rfx> and <laser.rfx> into <sounds.rfxp> bank at 22050 Hz, 16 bit, Mono\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.bin\n");
+    printf("        Process <sound.rfx> to generate <jump.bin> data and <jump.h> header to embed it (#embed/.incbin)\n\n");
+    printf("    > rfxgen --input sound.rfx --code jump.h\n");
+    printf("        Export <sound.rfx> parameters and generator to <jump.h>, synthesized at runtime\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.c\n");
+    printf("        Export <sound.rfx> as <jump.c> function JUMP_Generate(), generating only that sound\n\n");
+    printf("    > rfxgen --input sound.rfx --output jump.wav --format 44100,4,1\n");
+    printf("        Process <sound.rfx> to generate <jump.wav> as IMA-ADPCM (4 bit) at 44100 Hz, Mono\n\n");
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    printf("    > rfxgen --input sound.ogg --play output.wav\n");
+    printf("        Process <sound.ogg> to generate <output.wav> and play <output.wav>\n\n");
+    printf("    > rfxgen --input sound.mp3 --output jump.wav --format 22050,8,1 --play jump.wav\n");
+    printf("        Process <sound.mp3> to generate <jump.wav> at 22050 Hz, 8 bit, Stereo.\n");
+    printf("        Plays generated sound <jump.wav>.\n");
+#else
+    printf("    > rfxgen --generate coin --output coin.qoa\n");
+    printf("        Generate a random <coin.qoa> sound at 44100 Hz, 16 bit, Mono\n");
+#endif
+}
+
+// Process command line input, returns exit status
+// NOTE: Command line is refused (nothing processed, status 1) if outputs overwrite each other
+int ProcessCommandLine(int argc, char *argv[])
+{
+    // CLI required variables
+    bool showUsageInfo = false;         // Toggle command line usage info
+    char inFileName[512] = { 0 };       // Input file name
+    OutputTarget outputs[RFXGEN_CLI_MAX_OUTPUTS] = { 0 }; // Output files and formats
+    int outputCount = 0;                // Number of output files
+    bool functionOutputLast = false;    // Last output provided is a generation function code file (.c), no format
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    char playFileName[512] = { 0 };     // Play file name
+#endif
+    char presetType[32] = { 0 };        // Type of the preset to be generated
+    char bankFileName[512] = { 0 };     // Bank file name
+    char codeFileNames[2][512] = { 0 }; // Parameters code file names: [0] .h (--code), [1] .c (--output)
+    const char **bankInputs = NULL;     // Bank input files (command line arguments)
+    int bankInputCount = 0;             // Number of bank input files
+    int quantBits = 0;                  // Bank parameters quantization bits (0: not quantized)
+
+    int sampleRate = 44100;             // Default conversion sample rate
+    int sampleSize = 16;                // Default conversion sample size
+    int channels = 1;                   // Default conversion channels number
+    // NOTE: Default format can be changed with a --format not following an --output
+
+    if (argc == 1) showUsageInfo = true;
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            showUsageInfo = true;
+        }
+        else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
+        {
+            // Check for valid argument and valid file extension
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (RFXGEN_ISFILEEXTENSION(argv[i + 1], ".rfx")
+                    || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".wav")
+                    || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".qoa")
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+                    || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".ogg")
+                    || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".flac")
+                    || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".mp3")
+#endif
+                    )
+                {
+                    strcpy(inFileName, argv[i + 1]);    // Read input filename
+                }
+                else RFXGEN_CLI_LOG("WARNING: Input file extension not recognized\n");
+
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No input file provided\n");
+        }
+        else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (RFXGEN_ISFILEEXTENSION(argv[i + 1], ".c") && (strlen(argv[i + 1]) < 512))
+                {
+                    strcpy(codeFileNames[1], argv[i + 1]);  // Read generation function code filename
+                    functionOutputLast = true;
+                }
+                else if (RFXGEN_ISFILEEXTENSION(argv[i + 1], ".wav") ||
+                    RFXGEN_ISFILEEXTENSION(argv[i + 1], ".qoa") ||
+                    RFXGEN_ISFILEEXTENSION(argv[i + 1], ".raw") ||
+                    RFXGEN_ISFILEEXTENSION(argv[i + 1], ".h") ||
+                    RFXGEN_ISFILEEXTENSION(argv[i + 1], ".bin"))
+                {
+                    if ((outputCount < RFXGEN_CLI_MAX_OUTPUTS) && (strlen(argv[i + 1]) < 512))
+                    {
+                        strcpy(outputs[outputCount].fileName, argv[i + 1]);   // Read output filename
+                        outputCount++;
+                        functionOutputLast = false;
+                    }
+                    else RFXGEN_CLI_LOG("WARNING: Too many output files, max outputs: %i\n", RFXGEN_CLI_MAX_OUTPUTS);
+                }
+                else RFXGEN_CLI_LOG("WARNING: Output file extension not recognized\n");
+
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No output file provided\n");
+        }
+        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--format") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int formatSampleRate = 44100;
+                int formatSampleSize = 16;
+                int formatChannels = 1;
+
+                // Read values text and convert to integer values
+                if (sscanf(argv[i + 1], "%i,%i,%i", &formatSampleRate, &formatSampleSize, &formatChannels) != 3) RFXGEN_CLI_LOG("WARNING: Incorrect number of format values\n");
+
+                // Verify retrieved values are valid
+                if ((formatSampleRate != 44100) && (formatSampleRate != 22050))
+                {
+                    RFXGEN_CLI_LOG("WARNING: Sample rate not supported. Default: 44100 Hz\n");
+                    formatSampleRate = 44100;
+                }
+
+                if ((formatSampleSize != 4) && (formatSampleSize != 8) && (formatSampleSize != 16) && (formatSampleSize != 32))
+                {
+                    RFXGEN_CLI_LOG("WARNING: Sample size not supported. Default: 16 bit\n");
+                    formatSampleSize = 16;
+                }
+
+                if ((formatChannels != 1) && (formatChannels != 2))
+                {
+                    RFXGEN_CLI_LOG("WARNING: Channels number not supported. Default: 1 (mono)\n");
+                    formatChannels = 1;
+                }
+
+                // Format applies to previous output if it has no format defined yet,
+                // otherwise it becomes the default format for outputs without format
+                // NOTE: Generation function code files (.c) have no format, it is ignored
+                if (functionOutputLast) RFXGEN_CLI_LOG("WARNING: Format not supported by code file outputs (.c), ignored\n");
+                else if ((outputCount > 0) && !outputs[outputCount - 1].formatDefined)
+                {
+                    outputs[outputCount - 1].sampleRate = formatSampleRate;
+                    outputs[outputCount - 1].sampleSize = formatSampleSize;
+                    outputs[outputCount - 1].channels = formatChannels;
+                    outputs[outputCount - 1].formatDefined = true;
+                }
+                else
+                {
+                    sampleRate = formatSampleRate;
+                    sampleSize = formatSampleSize;
+                    channels = formatChannels;
+                }
+
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: Format parameters provided not valid\n");
+        }
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+        else if ((strcmp(argv[i], "-p") == 0) || (strcmp(argv[i], "--play") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 1], ".wav") ||
+                    IsFileExtension(argv[i + 1], ".qoa") ||
+                    IsFileExtension(argv[i + 1], ".ogg") ||
+                    IsFileExtension(argv[i + 1], ".flac") ||
+                    IsFileExtension(argv[i + 1], ".mp3"))
+                {
+                    strcpy(playFileName, argv[i + 1]);   // Read filename to play
+                }
+                else RFXGEN_CLI_LOG("WARNING: Play file format not supported\n");
+
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No file to play provided\n");
+        }
+#endif
+        else if ((strcmp(argv[i], "-b") == 0) || (strcmp(argv[i], "--bank") == 0))
+        {
+            if (((i + 1) < argc) && (RFXGEN_ISFILEEXTENSION(argv[i + 1], ".rfxb") || RFXGEN_ISFILEEXTENSION(argv[i + 1], ".rfxp")) && (strlen(argv[i + 1]) < 512))
+            {
+                strcpy(bankFileName, argv[i + 1]);
+                i++;
+
+                // Following arguments are bank input files
+                bankInputs = (const char **)(argv + i + 1);
+                bankInputCount = 0;
+
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+                {
+                    bankInputCount++;
+                    i++;
+                }
+            }
+            else RFXGEN_CLI_LOG("WARNING: No bank file provided (.rfxb, .rfxp)\n");
+        }
+        else if ((strcmp(argv[i], "-q") == 0) || (strcmp(argv[i], "--quantize") == 0))
+        {
+            if ((i + 1) < argc)
+            {
+                if ((sscanf(argv[i + 1], "%i", &quantBits) != 1) || ((quantBits != 8) && (quantBits != 12) && (quantBits != 16)))
+                {
+                    RFXGEN_CLI_LOG("WARNING: Quantization bits not supported, parameters not quantized\n");
+                    quantBits = 0;
+                }
+
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No quantization bits provided\n");
+        }
+        else if ((strcmp(argv[i], "-c") == 0) || (strcmp(argv[i], "--code") == 0))
+        {
+            if (((i + 1) < argc) && RFXGEN_ISFILEEXTENSION(argv[i + 1], ".h") && (strlen(argv[i + 1]) < 512))
+            {
+                strcpy(codeFileNames[0], argv[i + 1]);  // Read parameters code filename
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No code file provided (.h)\n");
+        }
+        else if ((strcmp(argv[i], "-g") == 0) || (strcmp(argv[i], "--generate") == 0))
+        {
+            if (((i + 1) < argc) && (strlen(argv[i + 1]) < 32))
+            {
+                strcpy(presetType, argv[i + 1]); // Saves the preset to generate
+                i++;
+            }
+            else RFXGEN_CLI_LOG("WARNING: No preset provided\n");
+        }
+    }
+
+    // Set a default name for output in case not provided
+    // NOTE: Only parameters code files are exported if requested without outputs
+    if ((outputCount == 0) && (codeFileNames[0][0] == '\0') && (codeFileNames[1][0] == '\0'))
+    {
+        strcpy(outputs[0].fileName, "output.wav");
+        outputCount = 1;
+    }
+
+    // Embedding data outputs (.bin) also write a header with same name (.h), it must not overwrite
+    // another output or parameters code file, command line is refused in that case
+    // NOTE: Error is always reported (stderr), release builds do not log warnings
+    for (int i = 0; i < outputCount; i++)
+    {
+        if (RFXGEN_ISFILEEXTENSION(outputs[i].fileName, ".bin"))
+        {
+            char headerFileName[512] = { 0 };
+            RFXGEN_MEMCPY(headerFileName, outputs[i].fileName, strlen(outputs[i].fileName) - 4);
+            strcat(headerFileName, ".h");
+
+            bool collision = (strcmp(headerFileName, codeFileNames[0]) == 0);
+            for (int j = 0; (j < outputCount) && !collision; j++) collision = (strcmp(headerFileName, outputs[j].fileName) == 0);
+
+            if (collision)
+            {
+                fprintf(stderr, "ERROR: Embedding header %s (from %s) overwrites another output, nothing exported\n", headerFileName, outputs[i].fileName);
+                return 1;
+            }
+        }
+    }
+
+    // Outputs without a format defined use default format
+    // NOTE: Code outputs (.h, .bin) require the full wave data, they are moved to a separate list
+    // so audio outputs (.wav, .qoa, .raw) are still streamed with fixed memory
+    OutputTarget codeOutputs[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+    int codeOutputCount = 0;
+    int audioOutputCount = 0;
+
+    for (int i = 0; i < outputCount; i++)
+    {
+        if (!outputs[i].formatDefined)
+        {
+            outputs[i].sampleRate = sampleRate;
+            outputs[i].sampleSize = sampleSize;
+            outputs[i].channels = channels;
+        }
+
+        // 4 bit samples (IMA-ADPCM) are only supported by .wav files
+        if ((outputs[i].sampleSize == 4) && !RFXGEN_ISFILEEXTENSION(outputs[i].fileName, ".wav"))
+        {
+            RFXGEN_CLI_LOG("WARNING: 4 bit (ADPCM) only supported for .wav outputs. Default: 16 bit\n");
+            outputs[i].sampleSize = 16;
+        }
+
+        if (RFXGEN_ISFILEEXTENSION(outputs[i].fileName, ".h") ||
+            RFXGEN_ISFILEEXTENSION(outputs[i].fileName, ".bin")) codeOutputs[codeOutputCount++] = outputs[i];
+        else outputs[audioOutputCount++] = outputs[i];
+    }
+
+    outputCount = audioOutputCount;
+
+    // Process input file if provided
+    // NOTE: Sound is generated/decoded once for all audio outputs and once for all code outputs
+    if (inFileName[0] != '\0')
+    {
+        RFXGEN_CLI_LOG("\nInput file:       %s\n\n", inFileName);
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (codeFileNames[i][0] == '\0') continue;
+
+            if (RFXGEN_ISFILEEXTENSION(inFileName, ".rfx"))
+            {
+                RFXGEN_CLI_LOG("Code file:        %s (parameters)\n", codeFileNames[i]);
+                if (!ExportWaveParamsCode(LoadWaveParams(inFileName), codeFileNames[i])) RFXGEN_CLI_LOG("WARNING: Parameters code file could not be exported\n");
+            }
+            else RFXGEN_CLI_LOG("WARNING: Parameters code file requires a sound input (.rfx)\n");
+        }
+
+        if (outputCount > 0)
+        {
+            // Sounds (RFX) and audio files (WAV, QOA, OGG, FLAC, MP3) are generated/decoded in chunks,
+            // with fixed memory usage, every chunk is converted and written to all audio outputs
+            AudioReader reader = { 0 };
+
+            if (!LoadAudioReader(&reader, inFileName) || !TranscodeAudio(&reader, outputs, outputCount)) RFXGEN_CLI_LOG("WARNING: Audio file could not be transcoded\n");
+
+            UnloadAudioReader(&reader);
+        }
+
+        if (codeOutputCount > 0)
+        {
+            // Code file export requires the full wave data
+            WaveBuffer wave = LoadAudioFileBuffer(inFileName);
+
+            // Format wave data to every code output sampleRate, sampleSize and channels and
+            // export it as code file (.h) or embedding data (.bin)
+            if (wave.data != NULL) ExportWaveTargets(wave, codeOutputs, codeOutputCount);
+
+            UnloadWaveBuffer(wave);
+        }
+    }
+
+    // Process generate sound if type provided
+    if (presetType[0] != '\0')
+    {
+        WaveParams params = { 0 };
+        bool validPreset = true;
+
+        if (strcmp(presetType, "coin") == 0)            params = GenPickupCoin();
+        else if (strcmp(presetType, "laser") == 0)      params = GenLaserShoot();
+        else if (strcmp(presetType, "explosion") == 0)  params = GenExplosion();
+        else if (strcmp(presetType, "powerup") == 0)    params = GenPowerup();
+        else if (strcmp(presetType, "hit") == 0)        params = GenHitHurt();
+        else if (strcmp(presetType, "jump") == 0)       params = GenJump();
+        else if (strcmp(presetType, "blip") == 0)       params = GenBlipSelect();
+        else
+        {
+            RFXGEN_CLI_LOG("Unrecognized type of preset.\n");
+            validPreset = false;
+        }
+
+        for (int i = 0; (i < 2) && validPreset; i++)
+        {
+            if (codeFileNames[i][0] == '\0') continue;
+
+            RFXGEN_CLI_LOG("Code file:        %s (parameters)\n", codeFileNames[i]);
+            if (!ExportWaveParamsCode(params, codeFileNames[i])) RFXGEN_CLI_LOG("WARNING: Parameters code file could not be exported\n");
+        }
+
+        if (validPreset && (outputCount > 0))
+        {
+            // Generated sound is written in chunks to all audio outputs
+            AudioReader reader = { 0 };
+
+            if (!LoadAudioGenerator(&reader, params) || !TranscodeAudio(&reader, outputs, outputCount)) RFXGEN_CLI_LOG("WARNING: Sound could not be generated\n");
+
+            UnloadAudioReader(&reader);
+        }
+
+        if (validPreset && (codeOutputCount > 0))
+        {
+            // NOTE: GenerateWave() returns data as 32bit float, 1 channel by default
+            WaveBuffer wave = { 0 };
+            wave.sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+            wave.sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
+            wave.channels = RFXGEN_GEN_CHANNELS;
+            wave.data = GenerateWave(params, &wave.frameCount);
+
+            if (wave.data != NULL) ExportWaveTargets(wave, codeOutputs, codeOutputCount);
+
+            UnloadWaveBuffer(wave);
+        }
+    }
+
+    // Pack sounds parameters into bank file if provided
+    if (bankFileName[0] != '\0')
+    {
+        if (!PackWaveBank(bankFileName, bankInputs, bankInputCount, quantBits, sampleRate, sampleSize, channels)) RFXGEN_CLI_LOG("WARNING: Sounds bank could not be packed\n");
+    }
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    // Play audio file if provided (WAV, QOA, OGG, FLAC, MP3)
+    if (playFileName[0] != '\0') PlayMusicCLI(playFileName);
+#endif
+
+    if (showUsageInfo) ShowCommandLineInfo();
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Load audio file reader
+// NOTE: WAV and QOA files are decoded progressively, RFX files are generated progressively,
+// other formats are fully loaded (raylib)
+static bool LoadAudioReader(AudioReader *reader, const char *fileName)
+{
+    *reader = (AudioReader){ 0 };
+
+    if (RFXGEN_ISFILEEXTENSION(fileName, ".rfx")) return LoadAudioGenerator(reader, LoadWaveParams(fileName));
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".wav"))
+    {
+        FILE *file = fopen(fileName, "rb");
+        if (file == NULL) return false;
+
+        unsigned char header[40] = { 0 };
+        unsigned int dataSize = 0;
+        unsigned int factFrames = 0;
+        int format = 0;
+        bool dataFound = false;
+
+        // Check RIFF/WAVE signature and look for "fmt " and "data" chunks
+        if ((fread(header, 1, 12, file) == 12) && (memcmp(header, "RIFF", 4) == 0) && (memcmp(header + 8, "WAVE", 4) == 0))
+        {
+            while (!dataFound && (fread(header, 1, 8, file) == 8))
+            {
+                unsigned int chunkSize = header[4] | (header[5] << 8) | (header[6] << 16) | ((unsigned int)header[7] << 24);
+
+                if (memcmp(header, "fmt ", 4) == 0)
+                {
+                    unsigned int size = (chunkSize < 40)? chunkSize : 40;
+                    if (fread(header, 1, size, file) != size) break;
+
+                    format = header[0] | (header[1] << 8);
+                    reader->channels = header[2] | (header[3] << 8);
+                    reader->sampleRate = header[4] | (header[5] << 8) | (header[6] << 16) | ((unsigned int)header[7] << 24);
+                    reader->blockAlign = header[12] | (header[13] << 8);
+                    reader->sampleSize = header[14] | (header[15] << 8);
+
+                    // WAVE_FORMAT_EXTENSIBLE: format defined by sub-format GUID first bytes
+                    if ((format == 0xfffe) && (size >= 26)) format = header[24] | (header[25] << 8);
+
+                    fseek(file, (long)(chunkSize - size + (chunkSize & 1)), SEEK_CUR);
+                }
+                else if ((memcmp(header, "fact", 4) == 0) && (chunkSize >= 4))
+                {
+                    if (fread(header, 1, 4, file) != 4) break;
+
+                    factFrames = header[0] | (header[1] << 8) | (header[2] << 16) | ((unsigned int)header[3] << 24);
+                    fseek(file, (long)(chunkSize - 4 + (chunkSize & 1)), SEEK_CUR);
+                }
+                else if (memcmp(header, "data", 4) == 0)
+                {
+                    dataSize = chunkSize;
+                    dataFound = true;
+                }
+                else fseek(file, (long)(chunkSize + (chunkSize & 1)), SEEK_CUR);
+            }
+        }
+
+        if (dataFound && (reader->channels > 0) && (reader->sampleRate > 0) &&
+            (((format == 1) && ((reader->sampleSize == 8) || (reader->sampleSize == 16) || (reader->sampleSize == 24) || (reader->sampleSize == 32))) ||
+             ((format == 3) && (reader->sampleSize == 32))))
+        {
+            reader->fileType = (format == 3)? 1 : 0;
+            reader->frameCount = dataSize/(reader->channels*reader->sampleSize/8);
+            reader->file = file;
+            reader->buffer = (unsigned char *)RFXGEN_CALLOC(RFXGEN_CLI_CHUNK_FRAMES*reader->channels, reader->sampleSize/8);
+        }
+        else if (dataFound && (format == 0x0011) && (reader->sampleSize == 4) && (reader->sampleRate > 0) &&
+                 (GetAdpcmBlockFrames(reader->blockAlign, reader->channels) > 0))
+        {
+            // IMA-ADPCM: Frame count from "fact" chunk, last block could be padded
+            unsigned int blockFrames = GetAdpcmBlockFrames(reader->blockAlign, reader->channels);
+
+            reader->fileType = 5;
+            reader->frameCount = dataSize/reader->blockAlign*blockFrames;
+            if ((factFrames > 0) && (factFrames < reader->frameCount)) reader->frameCount = factFrames;
+            reader->file = file;
+            reader->buffer = (unsigned char *)RFXGEN_CALLOC(reader->blockAlign, 1);
+            reader->samples = (short *)RFXGEN_CALLOC(blockFrames*reader->channels, sizeof(short));
+        }
+        else
+        {
+            RFXGEN_CLI_LOG("WARNING: WAV file format not supported: %s\n", fileName);
+            fclose(file);
+        }
+    }
+    else if (RFXGEN_ISFILEEXTENSION(fileName, ".qoa"))
+    {
+        FILE *file = fopen(fileName, "rb");
+        if (file == NULL) return false;
+
+        unsigned char header[16] = { 0 };
+
+        // File header and first frame header, required to get channels and sample rate
+        if ((fread(header, 1, 16, file) == 16) && (memcmp(header, "qoaf", 4) == 0) && (header[8] > 0) && (header[8] <= QOA_MAX_CHANNELS))
+        {
+            reader->fileType = 2;
+            reader->frameCount = ((unsigned int)header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+            reader->channels = header[8];
+            reader->sampleRate = (header[9] << 16) | (header[10] << 8) | header[11];
+            reader->sampleSize = 16;
+            reader->file = file;
+            reader->buffer = (unsigned char *)RFXGEN_CALLOC(QOA_FRAME_SIZE(QOA_MAX_CHANNELS, QOA_SLICES_PER_FRAME), 1);
+            reader->samples = (short *)RFXGEN_CALLOC(QOA_FRAME_LEN*reader->channels, sizeof(short));
+
+            fseek(file, 8, SEEK_SET);
+        }
+        else
+        {
+            RFXGEN_CLI_LOG("WARNING: QOA file not valid: %s\n", fileName);
+            fclose(file);
+        }
+    }
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    else
+    {
+        // NOTE: raylib does not provide progressive decoding, full wave data is loaded
+        Wave wave = LoadWave(fileName);
+
+        if (wave.data != NULL)
+        {
+            reader->fileType = 3;
+            reader->wave = (WaveBuffer){ wave.frameCount, wave.sampleRate, wave.sampleSize, wave.channels, wave.data };
+            reader->frameCount = wave.frameCount;
+            reader->sampleRate = wave.sampleRate;
+            reader->sampleSize = wave.sampleSize;
+            reader->channels = wave.channels;
+        }
+    }
+#endif
+
+    return ((reader->file != NULL) || (reader->wave.data != NULL));
+}
+
+// Load audio reader for wave generated from parameters
+// NOTE: Wave length is unknown until generation ends
+static bool LoadAudioGenerator(AudioReader *reader, WaveParams params)
+{
+    *reader = (AudioReader){ 0 };
+
+    reader->generator = LoadWaveGenerator(params);
+
+    if (IsWaveGeneratorValid(reader->generator))
+    {
+        reader->fileType = 4;
+        reader->sampleRate = reader->generator.sampleRate;
+        reader->sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
+        reader->channels = RFXGEN_GEN_CHANNELS;
+    }
+
+    return IsWaveGeneratorValid(reader->generator);
+}
+
+// Read float frames (channels interleaved), returns frames read
+static unsigned int ReadAudioFrames(AudioReader *reader, float *frames, unsigned int frameCount)
+{
+    unsigned int framesRead = 0;
+
+    if ((reader->fileType == 0) || (reader->fileType == 1))
+    {
+        // WAV: Read samples block and convert to float
+        if ((reader->frameCount - reader->position) < frameCount) frameCount = reader->frameCount - reader->position;
+        if (frameCount > RFXGEN_CLI_CHUNK_FRAMES) frameCount = RFXGEN_CLI_CHUNK_FRAMES;
+
+        unsigned int bytesPerSample = reader->sampleSize/8;
+        framesRead = (unsigned int)fread(reader->buffer, bytesPerSample*reader->channels, frameCount, reader->file);
+
+        for (unsigned int i = 0; i < framesRead*reader->channels; i++)
+        {
+            const unsigned char *sample = reader->buffer + i*bytesPerSample;
+
+            if (reader->fileType == 1)
+            {
+                unsigned int value = sample[0] | (sample[1] << 8) | (sample[2] << 16) | ((unsigned int)sample[3] << 24);
+                memcpy(&frames[i], &value, sizeof(float));
+            }
+            else if (bytesPerSample == 1) frames[i] = (float)(sample[0] - 128)/128.0f;
+            else if (bytesPerSample == 2) frames[i] = (float)(short)(sample[0] | (sample[1] << 8))/32768.0f;
+            else if (bytesPerSample == 3) frames[i] = (float)((int)(((unsigned int)sample[0] << 8) | ((unsigned int)sample[1] << 16) | ((unsigned int)sample[2] << 24)) >> 8)/8388608.0f;
+            else frames[i] = (float)(int)(sample[0] | (sample[1] << 8) | (sample[2] << 16) | ((unsigned int)sample[3] << 24))/2147483648.0f;
+        }
+    }
+    else if (reader->fileType == 2)
+    {
+        // QOA: Decode frames as required, copying decoded samples
+        while (framesRead < frameCount)
+        {
+            if (reader->samplesPosition >= reader->samplesCount)
+            {
+                unsigned char *bytes = reader->buffer;
+                reader->samplesCount = 0;
+                reader->samplesPosition = 0;
+
+                if (fread(bytes, 1, 8, reader->file) != 8) break;
+
+                unsigned int channels = bytes[0];
+                unsigned int length = (bytes[4] << 8) | bytes[5];
+                unsigned int size = (bytes[6] << 8) | bytes[7];
+
+                if ((channels != reader->channels) || (length > QOA_FRAME_LEN) || (size <= 8) ||
+                    (size > QOA_FRAME_SIZE(channels, QOA_SLICES_PER_FRAME)) ||
+                    (fread(bytes + 8, 1, size - 8, reader->file) != (size - 8))) break;
+
+                // Read LMS state per channel and decode slices
+                QoaLms lms[QOA_MAX_CHANNELS] = { 0 };
+                unsigned int position = 8;
+
+                for (unsigned int c = 0; c < channels; c++)
+                {
+                    for (int i = 0; i < QOA_LMS_LEN; i++) lms[c].history[i] = (short)((bytes[position + i*2] << 8) | bytes[position + i*2 + 1]);
+                    for (int i = 0; i < QOA_LMS_LEN; i++) lms[c].weights[i] = (short)((bytes[position + 8 + i*2] << 8) | bytes[position + 8 + i*2 + 1]);
+                    position += 16;
+                }
+
+                for (unsigned int sampleIndex = 0; sampleIndex < length; sampleIndex += QOA_SLICE_LEN)
+                {
+                    for (unsigned int c = 0; c < channels; c++)
+                    {
+                        if ((position + 8) > size) break;
+
+                        unsigned long long slice = 0;
+                        for (int i = 0; i < 8; i++) slice = (slice << 8) | bytes[position + i];
+                        position += 8;
+
+                        int scalefactor = (int)((slice >> 60) & 0xf);
+                        unsigned int sliceEnd = ((sampleIndex + QOA_SLICE_LEN) < length)? (sampleIndex + QOA_SLICE_LEN) : length;
+
+                        for (unsigned int si = sampleIndex; si < sliceEnd; si++)
+                        {
+                            int predicted = QoaLmsPredict(&lms[c]);
+                            int quantized = (int)((slice >> 57) & 0x7);
+                            int dequantized = qoaDequantTable[scalefactor][quantized];
+                            int reconstructed = QoaClamp(predicted + dequantized, -32768, 32767);
+
+                            reader->samples[si*channels + c] = (short)reconstructed;
+                            QoaLmsUpdate(&lms[c], reconstructed, dequantized);
+                            slice <<= 3;
+                        }
+                    }
+                }
+
+                reader->samplesCount = length;
+            }
+
+            unsigned int count = reader->samplesCount - reader->samplesPosition;
+            if (count > (frameCount - framesRead)) count = frameCount - framesRead;
+
+            for (unsigned int i = 0; i < count*reader->channels; i++)
+            {
+                frames[framesRead*reader->channels + i] = (float)reader->samples[reader->samplesPosition*reader->channels + i]/32768.0f;
+            }
+
+            reader->samplesPosition += count;
+            framesRead += count;
+        }
+    }
+    else if (reader->fileType == 3)
+    {
+        // Loaded wave: Convert samples from memory
+        if ((reader->frameCount - reader->position) < frameCount) frameCount = reader->frameCount - reader->position;
+
+        for (unsigned int i = 0; i < frameCount; i++)
+        {
+            for (unsigned int c = 0; c < reader->channels; c++) frames[i*reader->channels + c] = GetWaveBufferSample(reader->wave, reader->position + i, c, reader->channels);
+        }
+
+        framesRead = frameCount;
+    }
+    else if (reader->fileType == 4)
+    {
+        // Generated wave: Generate next frames block
+        framesRead = GenerateWaveFrames(&reader->generator, frames, frameCount);
+    }
+    else if (reader->fileType == 5)
+    {
+        // IMA-ADPCM: Decode blocks as required, copying decoded samples
+        if ((reader->frameCount - reader->position) < frameCount) frameCount = reader->frameCount - reader->position;
+
+        while (framesRead < frameCount)
+        {
+            if (reader->samplesPosition >= reader->samplesCount)
+            {
+                reader->samplesCount = 0;
+                reader->samplesPosition = 0;
+
+                if (fread(reader->buffer, 1, reader->blockAlign, reader->file) != reader->blockAlign) break;
+
+                DecodeAdpcmBlock(reader->buffer, reader->blockAlign, reader->channels, reader->samples);
+                reader->samplesCount = GetAdpcmBlockFrames(reader->blockAlign, reader->channels);
+            }
+
+            unsigned int count = reader->samplesCount - reader->samplesPosition;
+            if (count > (frameCount - framesRead)) count = frameCount - framesRead;
+
+            for (unsigned int i = 0; i < count*reader->channels; i++)
+            {
+                frames[framesRead*reader->channels + i] = (float)reader->samples[reader->samplesPosition*reader->channels + i]/32768.0f;
+            }
+
+            reader->samplesPosition += count;
+            framesRead += count;
+        }
+    }
+
+    reader->position += framesRead;
+
+    return framesRead;
+}
+
+// Unload audio file reader
+static void UnloadAudioReader(AudioReader *reader)
+{
+    if (reader->file != NULL) fclose(reader->file);
+    RFXGEN_FREE(reader->buffer);
+    RFXGEN_FREE(reader->samples);
+    UnloadWaveGenerator(reader->generator);
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+    if (reader->wave.data != NULL) UnloadWave((Wave){ reader->wave.frameCount, reader->wave.sampleRate, reader->wave.sampleSize, reader->wave.channels, reader->wave.data });
+#endif
+
+    *reader = (AudioReader){ 0 };
+}
+
+// Load full audio file into wave buffer (32 bit float)
+static WaveBuffer LoadAudioFileBuffer(const char *fileName)
+{
+    WaveBuffer wave = { 0 };
+    AudioReader reader = { 0 };
+
+    if (LoadAudioReader(&reader, fileName))
+    {
+        // NOTE: Frame count could be unknown (QOA streaming files), buffer grows as required
+        unsigned int capacity = (reader.frameCount > 0)? reader.frameCount : RFXGEN_CLI_CHUNK_FRAMES;
+        float *data = (float *)RFXGEN_CALLOC(capacity*reader.channels, sizeof(float));
+        unsigned int frameCount = 0;
+        unsigned int framesRead = 0;
+
+        while (data != NULL)
+        {
+            if (frameCount == capacity)
+            {
+                float *grown = (float *)RFXGEN_REALLOC(data, capacity*2*reader.channels*sizeof(float));
+
+                if (grown == NULL)
+                {
+                    RFXGEN_FREE(data);
+                    data = NULL;
+                    break;
+                }
+
+                data = grown;
+                capacity *= 2;
+            }
+
+            framesRead = ReadAudioFrames(&reader, data + frameCount*reader.channels, capacity - frameCount);
+            frameCount += framesRead;
+
+            if (framesRead == 0) break;
+        }
+
+        if (data != NULL) wave = (WaveBuffer){ frameCount, reader.sampleRate, 32, reader.channels, data };
+        UnloadAudioReader(&reader);
+    }
+
+    return wave;
+}
+
+// Get converted input sample, mixing channels if required
+// NOTE: Frame -1 refers to last frame of previous chunk
+static float GetConverterSample(const AudioConverter *converter, const float *frames, int frame, unsigned int channel)
+{
+    float sample = 0.0f;
+
+    if (frame < 0) sample = converter->lastFrame[channel];
+    else if ((converter->outChannels == 1) && (converter->inChannels > 1))
+    {
+        for (unsigned int c = 0; c < converter->inChannels; c++) sample += frames[frame*converter->inChannels + c];
+        sample /= (float)converter->inChannels;
+    }
+    else sample = frames[frame*converter->inChannels + ((channel < converter->inChannels)? channel : (converter->inChannels - 1))];
+
+    return sample;
+}
+
+// Convert chunk frames, returns output frames
+// NOTE: Output must fit (frameCount + 1)*outSampleRate/inSampleRate + 1 frames
+// NOTE: Output positions are computed with integer math, no drift on long files
+static unsigned int ConvertAudioFrames(AudioConverter *converter, const float *frames, unsigned int frameCount, float *output)
+{
+    unsigned int outCount = 0;
+
+    if (frameCount == 0) return 0;
+
+    // Interpolate output frames while next input frame is available in current chunk
+    while (true)
+    {
+        unsigned long long position = converter->outPosition*converter->inSampleRate;
+        int frame = (int)((long long)(position/converter->outSampleRate) - (long long)converter->inPosition);
+        float factor = (float)(position%converter->outSampleRate)/converter->outSampleRate;
+
+        if ((frame + 1) >= (int)frameCount) break;
+
+        for (unsigned int c = 0; c < converter->outChannels; c++)
+        {
+            float sample = GetConverterSample(converter, frames, frame, c);
+            if (factor > 0.0f) sample += (GetConverterSample(converter, frames, frame + 1, c) - sample)*factor;
+
+            output[outCount*converter->outChannels + c] = sample;
+        }
+
+        outCount++;
+        converter->outPosition++;
+    }
+
+    for (unsigned int c = 0; c < converter->outChannels; c++) converter->lastFrame[c] = GetConverterSample(converter, frames, frameCount - 1, c);
+    converter->inPosition += frameCount;
+
+    return outCount;
+}
+
+// Get remaining output frames at stream end
+// NOTE: Total output frames match WaveBufferFormat(): inFrames*outSampleRate/inSampleRate
+static unsigned int FlushAudioConverter(AudioConverter *converter, float *output)
+{
+    unsigned int outCount = 0;
+
+    while (converter->outPosition < (converter->inPosition*converter->outSampleRate/converter->inSampleRate))
+    {
+        for (unsigned int c = 0; c < converter->outChannels; c++) output[outCount*converter->outChannels + c] = converter->lastFrame[c];
+
+        outCount++;
+        converter->outPosition++;
+    }
+
+    return outCount;
+}
+
+#if !defined(RFXGEN_NO_THREADS)
+// Decode audio file chunks into pipeline (decoder thread)
+// NOTE: An empty chunk (0 frames) marks the end of stream
+static void DecodeAudioChunks(void *data)
+{
+    TranscodePipeline *pipeline = (TranscodePipeline *)data;
+
+    for (unsigned int i = 0; ; i++)
+    {
+        unsigned int index = i%RFXGEN_CLI_CHUNK_COUNT;
+
+        RfxSemaphoreWait(&pipeline->emptyChunks);
+        pipeline->chunkFrames[index] = pipeline->abort? 0 : ReadAudioFrames(pipeline->reader, pipeline->chunks[index], RFXGEN_CLI_CHUNK_FRAMES);
+        RfxSemaphorePost(&pipeline->filledChunks);
+
+        if (pipeline->chunkFrames[index] == 0) break;
+    }
+}
+#endif
+
+// Transcode audio reader data to all outputs with fixed memory
+// NOTE: Decoding/generation runs on a separate thread, overlapped with conversion and encoding
+static bool TranscodeAudio(AudioReader *reader, const OutputTarget *outputs, int outputCount)
+{
+    bool success = true;
+
+    // Output writers, converters are shared by outputs with the same sample rate and channels
+    WaveWriter writers[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+    int writerConverters[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+    AudioConverter converters[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+    float *converted[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+    int converterCount = 0;
+
+    for (int i = 0; i < outputCount; i++)
+    {
+        writers[i] = OpenWaveWriter(outputs[i].fileName, outputs[i].sampleRate, outputs[i].sampleSize, outputs[i].channels);
+
+        if (!IsWaveWriterValid(writers[i]))
+        {
+            success = false;
+            break;
+        }
+
+        int c = 0;
+        while ((c < converterCount) &&
+               ((converters[c].outSampleRate != (unsigned int)outputs[i].sampleRate) ||
+                (converters[c].outChannels != (unsigned int)outputs[i].channels))) c++;
+
+        if (c == converterCount)
+        {
+            unsigned int outputFrames = (unsigned int)((unsigned long long)(RFXGEN_CLI_CHUNK_FRAMES + 1)*outputs[i].sampleRate/reader->sampleRate) + 2;
+
+            converters[c] = (AudioConverter){ reader->channels, outputs[i].channels, reader->sampleRate, outputs[i].sampleRate, 0, 0, { 0 } };
+            converted[c] = (float *)RFXGEN_CALLOC(outputFrames*outputs[i].channels, sizeof(float));
+            converterCount++;
+        }
+
+        writerConverters[i] = c;
+    }
+
+    if (success)
+    {
+        TranscodePipeline pipeline = { 0 };
+        pipeline.reader = reader;
+        for (int i = 0; i < RFXGEN_CLI_CHUNK_COUNT; i++) pipeline.chunks[i] = (float *)RFXGEN_CALLOC(RFXGEN_CLI_CHUNK_FRAMES*reader->channels, sizeof(float));
+
+#if !defined(RFXGEN_NO_THREADS)
+        RfxThread decoder = { 0 };
+        RfxSemaphoreInit(&pipeline.emptyChunks, RFXGEN_CLI_CHUNK_COUNT);
+        RfxSemaphoreInit(&pipeline.filledChunks, 0);
+
+        bool threaded = RfxThreadCreate(&decoder, DecodeAudioChunks, &pipeline);
+#else
+        bool threaded = false;
+#endif
+
+        for (unsigned int i = 0; ; i++)
+        {
+            unsigned int index = i%RFXGEN_CLI_CHUNK_COUNT;
+            unsigned int frameCount = 0;
+
+            if (threaded)
+            {
+#if !defined(RFXGEN_NO_THREADS)
+                RfxSemaphoreWait(&pipeline.filledChunks);
+#endif
+                frameCount = pipeline.chunkFrames[index];
+            }
+            else frameCount = ReadAudioFrames(reader, pipeline.chunks[index], RFXGEN_CLI_CHUNK_FRAMES);
+
+            if (frameCount == 0) break;
+
+            // Every decoded chunk is converted once per distinct output sample rate and channels
+            for (int c = 0; (c < converterCount) && success; c++)
+            {
+                unsigned int count = ConvertAudioFrames(&converters[c], pipeline.chunks[index], frameCount, converted[c]);
+
+                for (int k = 0; (k < outputCount) && success; k++)
+                {
+                    if (writerConverters[k] == c) success = WriteWaveFrames(&writers[k], converted[c], count);
+                }
+            }
+
+            if (!success) pipeline.abort = true;
+
+#if !defined(RFXGEN_NO_THREADS)
+            if (threaded) RfxSemaphorePost(&pipeline.emptyChunks);
+#endif
+        }
+
+#if !defined(RFXGEN_NO_THREADS)
+        if (threaded) RfxThreadJoin(decoder);
+        RfxSemaphoreUnload(&pipeline.emptyChunks);
+        RfxSemaphoreUnload(&pipeline.filledChunks);
+#endif
+
+        for (int c = 0; (c < converterCount) && success; c++)
+        {
+            unsigned int count = FlushAudioConverter(&converters[c], converted[c]);
+
+            for (int k = 0; (k < outputCount) && success; k++)
+            {
+                if (writerConverters[k] == c) success = WriteWaveFrames(&writers[k], converted[c], count);
+            }
+        }
+
+        for (int i = 0; i < RFXGEN_CLI_CHUNK_COUNT; i++) RFXGEN_FREE(pipeline.chunks[i]);
+    }
+
+    for (int i = 0; i < outputCount; i++)
+    {
+        if (IsWaveWriterValid(writers[i]) && !CloseWaveWriter(&writers[i])) success = false;
+    }
+
+    for (int c = 0; c < converterCount; c++) RFXGEN_FREE(converted[c]);
+
+    return success;
+}
+
+// Export wave to all output targets
+// NOTE: Sample rate and channels conversion is done once per distinct pair,
+// sample size conversion is done once per distinct format
+static bool ExportWaveTargets(WaveBuffer wave, const OutputTarget *outputs, int outputCount)
+{
+    bool success = true;
+    bool exported[RFXGEN_CLI_MAX_OUTPUTS] = { 0 };
+
+    for (int i = 0; i < outputCount; i++)
+    {
+        if (exported[i]) continue;
+
+        // Converted wave keeps 32 bit float samples, used as source for other sample sizes
+        WaveBuffer converted = WaveBufferCopy(wave);
+        WaveBufferFormat(&converted, outputs[i].sampleRate, 32, outputs[i].channels);
+
+        WaveBuffer formatted[2] = { 0 };    // Sample size variants: 8 bit, 16 bit
+
+        for (int j = i; j < outputCount; j++)
+        {
+            if (exported[j] || (outputs[j].sampleRate != outputs[i].sampleRate) || (outputs[j].channels != outputs[i].channels)) continue;
+
+            WaveBuffer *target = &converted;
+
+            // IMA-ADPCM encoder converts float samples directly
+            if ((outputs[j].sampleSize != 32) && (outputs[j].sampleSize != 4))
+            {
+                target = &formatted[(outputs[j].sampleSize == 8)? 0 : 1];
+
+                if (target->data == NULL)
+                {
+                    *target = WaveBufferCopy(converted);
+                    WaveBufferFormat(target, outputs[j].sampleRate, outputs[j].sampleSize, outputs[j].channels);
+                }
+            }
+
+            RFXGEN_CLI_LOG("Output file:      %s (%i Hz, %i bits, %s)\n", outputs[j].fileName, outputs[j].sampleRate, outputs[j].sampleSize, (outputs[j].channels == 1)? "Mono" : "Stereo");
+
+            bool result = (outputs[j].sampleSize == 4)? ExportWaveBufferADPCM(*target, outputs[j].fileName) : ExportWaveBuffer(*target, outputs[j].fileName);
+
+            if (!result) success = false;
+            exported[j] = true;
+        }
+
+        UnloadWaveBuffer(formatted[0]);
+        UnloadWaveBuffer(formatted[1]);
+        UnloadWaveBuffer(converted);
+    }
+
+    return success;
+}
+
+// Pack .rfx files into wave bank (.rfxb, .rfxp)
+// NOTE: Sound names are file names without path and extension,
+// .rfxp banks store sounds pre-rendered in provided format, .rfxb banks parameters can be quantized
+static bool PackWaveBank(const char *fileName, const char **inputs, int inputCount, int quantBits, int sampleRate, int sampleSize, int channels)
+{
+    bool success = false;
+
+    if (inputCount <= 0) return false;
+
+    for (int i = 0; i < inputCount; i++)
+    {
+        if (!RFXGEN_ISFILEEXTENSION(inputs[i], ".rfx"))
+        {
+            RFXGEN_CLI_LOG("WARNING: Bank input file extension not recognized: %s\n", inputs[i]);
+            return false;
+        }
+    }
+
+    // Load all input files in one call (read in parallel)
+    WaveParamsList list = LoadWaveParamsList(inputs, inputCount);
+    const WaveParams *params = list.params;
+
+    if (list.errorCount > 0)
+    {
+        for (unsigned int i = 0; i < list.count; i++)
+        {
+            if (list.errors[i] == RFXGEN_LOAD_ERROR_OPEN) RFXGEN_CLI_LOG("WARNING: Bank input file could not be opened: %s\n", inputs[i]);
+            else if (list.errors[i] == RFXGEN_LOAD_ERROR_READ) RFXGEN_CLI_LOG("WARNING: Bank input file truncated: %s\n", inputs[i]);
+            else if (list.errors[i] == RFXGEN_LOAD_ERROR_FORMAT) RFXGEN_CLI_LOG("WARNING: Bank input file not valid: %s\n", inputs[i]);
+            else if (list.errors[i] == RFXGEN_LOAD_ERROR_VERSION) RFXGEN_CLI_LOG("WARNING: Bank input file version not supported: %s\n", inputs[i]);
+        }
+
+        UnloadWaveParamsList(list);
+        return false;
+    }
+
+    char *namesData = (char *)RFXGEN_CALLOC(inputCount, 256);
+    const char **names = (const char **)RFXGEN_CALLOC(inputCount, sizeof(const char *));
+
+    for (int i = 0; i < inputCount; i++)
+    {
+        // Get file name without path and extension
+        const char *name = inputs[i];
+        for (const char *c = inputs[i]; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) name = c + 1;
+
+        int length = (int)(strlen(name) - strlen(".rfx"));
+        if (length > 255) length = 255;
+
+        names[i] = namesData + i*256;
+        memcpy(namesData + i*256, name, length);
+    }
+
+    if (RFXGEN_ISFILEEXTENSION(fileName, ".rfxp"))
+    {
+        // 4 bit samples (IMA-ADPCM) are not a runtime PCM format
+        if (sampleSize == 4) sampleSize = 16;
+
+        WaveBuffer *waves = (WaveBuffer *)RFXGEN_CALLOC(inputCount, sizeof(WaveBuffer));
+
+        for (int i = 0; i < inputCount; i++)
+        {
+            waves[i].sampleRate = RFXGEN_GEN_SAMPLE_RATE;
+            waves[i].sampleSize = RFXGEN_GEN_SAMPLE_SIZE;
+            waves[i].channels = RFXGEN_GEN_CHANNELS;
+            waves[i].data = GenerateWave(params[i], &waves[i].frameCount);
+
+            WaveBufferFormat(&waves[i], sampleRate, sampleSize, channels);
+        }
+
+        RFXGEN_CLI_LOG("Output bank:      %s (%i sounds, %i Hz, %i bits, %s)\n", fileName, inputCount, sampleRate, sampleSize, (channels == 1)? "Mono" : "Stereo");
+        success = SaveWavePcmBank(waves, names, inputCount, fileName);
+
+        for (int i = 0; i < inputCount; i++) UnloadWaveBuffer(waves[i]);
+        RFXGEN_FREE(waves);
+    }
+    else if (quantBits > 0)
+    {
+        RFXGEN_CLI_LOG("Output bank:      %s (%i sounds, %i bits quantized)\n", fileName, inputCount, quantBits);
+        success = SaveWaveBankEncoded(params, names, inputCount, quantBits, fileName);
+    }
+    else
+    {
+        RFXGEN_CLI_LOG("Output bank:      %s (%i sounds)\n", fileName, inputCount);
+        success = SaveWaveBank(params, names, inputCount, fileName);
+    }
+
+    RFXGEN_FREE(names);
+    RFXGEN_FREE(namesData);
+    UnloadWaveParamsList(list);
+
+    return success;
+}
+
+#if defined(RFXGEN_CLI_USE_RAYLIB)
+// Wait while music is playing, updating stream and progress bar
+// NOTE: Blocking wait on console input with a timeout, no busy-waiting and wall-clock timing
+static void WaitMusicPlayer(Music music)
+{
+    float musicLength = GetMusicTimeLength(music);
+
+    int percent = 0;
+    int prevPercent = -1;
+
+#if !defined(_WIN32)
+    // Disable console line buffering and echo, so key pressed is available immediately
+    struct termios oldt = { 0 };
+    struct termios newt = { 0 };
+    bool isTerminal = isatty(STDIN_FILENO);
+
+    if (isTerminal)
+    {
+        tcgetattr(STDIN_FILENO, &oldt);
+        newt = oldt;
+        newt.c_lflag &= ~(ICANON | ECHO);
+        tcsetattr(STDIN_FILENO, TCSANOW, &newt);
+    }
+#endif
+
+    while (IsMusicStreamPlaying(music))
+    {
+        UpdateMusicStream(music);       // Refill stream buffers if required
+
+        // Check for key pressed to stop playing
+        int key = WaitKeyPressed(RFXGEN_CLI_PLAYER_UPDATE_TIME);
+        if ((key == '\n') || (key == '\r') || (key == 27)) break;    // KEY_ENTER || KEY_ESCAPE
+
+        // Print console time bar
+        percent = (musicLength > 0.0f)? (int)(GetMusicTimePlayed(music)/musicLength*100.0f) : 100;
+
+        if (percent != prevPercent)
+        {
+            RFXGEN_CLI_LOG("\r[");
+            for (int j = 0; j < 50; j++)
+            {
+                if (j < percent/2) RFXGEN_CLI_LOG("=");
+                else RFXGEN_CLI_LOG(" ");
+            }
+            RFXGEN_CLI_LOG("] [%02i%%]", percent);
+
+            prevPercent = percent;
+        }
+    }
+
+#if !defined(_WIN32)
+    if (isTerminal) tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
+#endif
+
+    RFXGEN_CLI_LOG("\n\n");
+}
+
+// Play provided audio file through CLI
+// NOTE: Audio data is streamed, memory usage does not depend on file length
+static void PlayMusicCLI(const char *fileName)
+{
+    InitAudioDevice();                  // Init audio device
+    Music music = LoadMusicStream(fileName);
+
+    if (IsMusicValid(music))
+    {
+        music.looping = false;
+
+        printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
+        printf("//                                                                              //\n");
+        printf("// %s v%s - CLI audio player                                         //\n", TOOL_NAME, TOOL_VERSION);
+        printf("//                                                                              //\n");
+        printf("// more info and bugs-report: github.com/raysan5/rfxgen                         //\n");
+        printf("//                                                                              //\n");
+        printf("// Copyright (c) 2020-2026 raylib technologies (@raylibtech)                    //\n");
+        printf("//                                                                              //\n");
+        printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        printf("Playing sound [%.2f sec.]. Press ENTER to finish.\n", GetMusicTimeLength(music));
+
+        PlayMusicStream(music);         // Start music streaming
+        WaitMusicPlayer(music);         // Wait while audio is playing
+        StopMusicStream(music);
+    }
+    else RFXGEN_CLI_LOG("WARNING: Audio file could not be loaded: %s\n", fileName);
+
+    UnloadMusicStream(music);           // Unload music stream
+    CloseAudioDevice();                 // Close audio device
+}
+
+// Wait for a key pressed up to ms milliseconds, returns -1 on timeout
+// NOTE: If console input is not available (closed or redirected), it just waits
+static int WaitKeyPressed(int ms)
+{
+    int key = -1;
+
+#if defined(_WIN32)
+    if (WaitForSingleObject(GetStdHandle((unsigned long)-10), ms) == 0)   // STD_INPUT_HANDLE, WAIT_OBJECT_0
+    {
+        if (_kbhit()) key = _getch();
+        else Sleep(ms);                 // Input signaled but no key available (i.e. redirected input)
+    }
+#else
+    struct pollfd input = { STDIN_FILENO, POLLIN, 0 };
+
+    if (poll(&input, 1, ms) > 0)
+    {
+        unsigned char ch = 0;
+
+        if ((input.revents & POLLIN) && (read(STDIN_FILENO, &ch, 1) == 1)) key = ch;
+        else poll(NULL, 0, ms);         // Input closed (EOF), just wait
+    }
+#endif
+
+    return key;
+}
+#endif // RFXGEN_CLI_USE_RAYLIB
+
+#endif // RFXGEN_CLI_IMPLEMENTATION
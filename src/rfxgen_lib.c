@@ -0,0 +1,35 @@
+/*******************************************************************************************
+*
+*   rfxgen library - Sound generation library build (librfxgen)
+*
+*   Compiles rfxgen.h implementation in its own translation unit, so it can be built once
+*   as a static or shared library and linked by multiple projects
+*
+*   BUILDING:
+*     - Static library:     gcc -c rfxgen_lib.c -std=c99 -O2 && ar rcs librfxgen.a rfxgen_lib.o
+*     - Shared library:     gcc -shared -fPIC -fvisibility=hidden -DBUILD_LIBTYPE_SHARED -o librfxgen.so rfxgen_lib.c -std=c99 -O2 -lm -lpthread
+*     NOTE: Static library users must link -lm -lpthread (not required with -DRFXGEN_NO_THREADS)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#define RFXGEN_IMPLEMENTATION
+#include "rfxgen.h"
@@ -0,0 +1,1145 @@
+/*******************************************************************************************
+*
+*   rfxgen tests - Sound generation library checks (rfxgen.h)
+*
+*   Tests are built in two steps, exported code files must be compiled to be checked:
+*     1. Export (RFXGEN_TEST_EXPORT): test sounds are exported as code files into a directory,
+*        parameters code files (<name>.h) and generation functions (<name>_function.c),
+*        plus a sounds list header (rfxgen_test_sounds.h) referencing them
+*     2. Test: exported code files are compiled in and their generated samples are compared
+*        sample by sample with GenerateWave() output, any difference is a drift between
+*        library generator and exported generator code
+*
+*   BUILDING:
+*     - CMake:          cmake -S projects/CMake -B build && cmake --build build && ctest --test-dir build
+*     NOTE: Floating-point contraction (FMA) must be disabled (-ffp-contract=off) to get exact results
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2026 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#define RFXGEN_IMPLEMENTATION
+#include "rfxgen.h"                         // Sound generation library
+
+#include <stdio.h>                          // Required for: printf(), fopen(), fprintf(), fclose()
+#include <string.h>                         // Required for: strcmp(), memcpy()
+
+#if defined(RFXGEN_TEST_EXPORT)
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Test sound preset, generated with a fixed random seed
+typedef struct TestPreset {
+    const char *name;               // Preset name, also exported files name
+    WaveParams (*generate)(void);   // Preset parameters generation function
+} TestPreset;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const TestPreset testPresets[] = {
+    { "coin", GenPickupCoin },
+    { "laser", GenLaserShoot },
+    { "explosion", GenExplosion },
+    { "powerup", GenPowerup },
+    { "hit", GenHitHurt },
+    { "jump", GenJump },
+    { "blip", GenBlipSelect },
+    { "random", GenRandomize },
+};
+
+//------------------------------------------------------------------------------------
+// Program main entry point: export test sounds
+// Usage: rfxgen_test_export <output_dir> <preset> [<preset> ...]
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if (argc < 3) return 1;
+
+    char fileName[512] = { 0 };
+    snprintf(fileName, 512, "%s/rfxgen_test_sounds.h", argv[1]);
+
+    FILE *listFile = fopen(fileName, "wt");
+    if (listFile == NULL) return 1;
+
+    fprintf(listFile, "// Test sounds list, exported by rfxgen_test_export\n");
+    for (int i = 2; i < argc; i++) fprintf(listFile, "#include \"%s.h\"\n", argv[i]);
+
+    // Generation functions are compiled as separate files (<name>_function.c)
+    fprintf(listFile, "\n");
+    for (int i = 2; i < argc; i++)
+    {
+        snprintf(fileName, 512, "%s_function.c", argv[i]);
+
+        char name[256] = { 0 };
+        SetCodeVarName(name, fileName);
+        fprintf(listFile, "unsigned int %s_Generate(float *frames);\n", name);
+    }
+
+    fprintf(listFile, "\nstatic const TestSound testSounds[] = {\n");
+
+    int result = 0;
+
+    for (int i = 2; i < argc; i++)
+    {
+        int preset = 0;
+        while ((preset < (int)(sizeof(testPresets)/sizeof(testPresets[0]))) && (strcmp(testPresets[preset].name, argv[i]) != 0)) preset++;
+
+        if (preset == (int)(sizeof(testPresets)/sizeof(testPresets[0])))
+        {
+            printf("ERROR: Test preset not recognized: %s\n", argv[i]);
+            result = 1;
+            break;
+        }
+
+        // NOTE: Fixed seed per preset, exported sounds only change if generator changes
+        RFXGEN_SRAND(1000 + preset);
+        WaveParams params = testPresets[preset].generate();
+
+        // Parameters code file (.h): parameters and minimal generator
+        snprintf(fileName, 512, "%s/%s.h", argv[1], argv[i]);
+
+        if (!ExportWaveParamsCode(params, fileName))
+        {
+            printf("ERROR: Test sound could not be exported: %s\n", fileName);
+            result = 1;
+            break;
+        }
+
+        char name[256] = { 0 };
+        SetCodeVarName(name, fileName);
+
+        // Generation function code file (.c): specialized function for this sound only
+        snprintf(fileName, 512, "%s/%s_function.c", argv[1], argv[i]);
+
+        if (!ExportWaveParamsCode(params, fileName))
+        {
+            printf("ERROR: Test sound could not be exported: %s\n", fileName);
+            result = 1;
+            break;
+        }
+
+        char functionName[256] = { 0 };
+        SetCodeVarName(functionName, fileName);
+        fprintf(listFile, "    { \"%s\", &%s_PARAMS, %s_GetData, %s_FRAME_COUNT, %s_Generate },\n", argv[i], name, name, name, functionName);
+    }
+
+    fprintf(listFile, "};\n");
+    fclose(listFile);
+
+    return result;
+}
+
+#else
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Exported test sound, parameters code file (.h) and generation function code file (.c) symbols
+typedef struct TestSound {
+    const char *name;                       // Preset name
+    const void *params;                     // Exported parameters (RfxSynthParams, WaveParams layout)
+    const float *(*getData)(void);          // Exported generator: get synthesized data
+    unsigned int frameCount;                // Exported frame count
+    unsigned int (*generate)(float *frames); // Exported generation function, frames array requires frameCount values
+} TestSound;
+
+#include "rfxgen_test_sounds.h"             // Test sounds: testSounds[]
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static bool CompareFrames(const char *test, const char *name, const float *expected, unsigned int expectedCount, const float *frames, unsigned int frameCount); // Compare frames sample by sample, log first difference
+static unsigned char *LoadTestFile(const char *fileName, unsigned int *size); // Load test file data, NULL if file can not be read
+static const unsigned char *FindWavChunk(const unsigned char *data, unsigned int size, const char *id, unsigned int *chunkSize); // Find .wav file chunk data, NULL if not found
+static float *LoadCodecSamples(unsigned int index, unsigned int channels, unsigned int *frameCount); // Load codec test samples: test sound or sine wave (index == sound count)
+static unsigned long long ReadQoaU64(const unsigned char *data, unsigned int *position); // Read big-endian 64 bit value, position is advanced
+static short *DecodeQoa(const unsigned char *data, unsigned int size, unsigned int *channels, unsigned int *frameCount); // Decode .qoa file data to 16 bit samples, NULL if not valid
+static bool CompareFiles(const char *test, const char *name, const char *fileName, const char *expectedFileName); // Compare files data, log first difference
+static int TestSynthCode(void);     // Test parameters code file (.h) generator matches GenerateWave()
+static int TestFunctionCode(void);  // Test generation function code file (.c) matches GenerateWave()
+static int TestInterleaved(void);   // Test interleaved generators match GenerateWave()
+static int TestEncodeMutated(void); // Test quantized encoding round-trip of mutated parameters
+static int TestMutateVariety(void); // Test mutations of same parameters differ
+static int TestAdpcm(void);         // Test IMA-ADPCM export decoded by blocks matches 16 bit samples
+static int TestAdpcmMalformed(void); // Test IMA-ADPCM invalid block sizes are rejected
+static int TestQoa(void);           // Test QOA export decoded matches 16 bit samples
+static int TestWaveWriter(void);    // Test streaming writer files match wave buffer export files
+static int TestEmbed(void);         // Test embedding data file (.bin) matches raw samples, header describes it
+static int TestWaveBank(void);      // Test parameters bank save/load and lookup by name
+static int TestWavePcmBank(void);   // Test data bank save/load, sounds data matches rendered frames
+static int TestParamsList(void);    // Test parameters list loading with missing and corrupt files
+
+//------------------------------------------------------------------------------------
+// Program main entry point: run tests
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    int failed = 0;
+
+    failed += TestSynthCode();
+    failed += TestFunctionCode();
+    failed += TestInterleaved();
+    failed += TestEncodeMutated();
+    failed += TestMutateVariety();
+    failed += TestAdpcm();
+    failed += TestAdpcmMalformed();
+    failed += TestQoa();
+    failed += TestWaveWriter();
+    failed += TestEmbed();
+    failed += TestWaveBank();
+    failed += TestWavePcmBank();
+    failed += TestParamsList();
+
+    if (failed > 0) printf("\n%i test(s) FAILED\n", failed);
+    else printf("\nAll tests passed\n");
+
+    return (failed > 0)? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Compare frames sample by sample, log first difference
+static bool CompareFrames(const char *test, const char *name, const float *expected, unsigned int expectedCount, const float *frames, unsigned int frameCount)
+{
+    if ((expected == NULL) || (frames == NULL) || (expectedCount != frameCount))
+    {
+        printf("[%s] %s: FAILED, frame count %u, expected %u\n", test, name, frameCount, expectedCount);
+        return false;
+    }
+
+    for (unsigned int i = 0; i < frameCount; i++)
+    {
+        if (frames[i] != expected[i])
+        {
+            printf("[%s] %s: FAILED, frame %u: %.9g, expected %.9g\n", test, name, i, frames[i], expected[i]);
+            return false;
+        }
+    }
+
+    printf("[%s] %s: OK (%u frames)\n", test, name, frameCount);
+
+    return true;
+}
+
+// Load test file data, NULL if file can not be read
+static unsigned char *LoadTestFile(const char *fileName, unsigned int *size)
+{
+    unsigned char *data = NULL;
+    *size = 0;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        long length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (length > 0) data = (unsigned char *)RFXGEN_CALLOC(length, 1);
+
+        if ((data != NULL) && (fread(data, 1, length, file) == (size_t)length)) *size = (unsigned int)length;
+        else
+        {
+            RFXGEN_FREE(data);
+            data = NULL;
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Find .wav file chunk data, NULL if not found
+static const unsigned char *FindWavChunk(const unsigned char *data, unsigned int size, const char *id, unsigned int *chunkSize)
+{
+    unsigned int offset = 12;   // RIFF header
+
+    while ((data != NULL) && ((offset + 8) <= size))
+    {
+        unsigned int length = data[offset + 4] | (data[offset + 5] << 8) | (data[offset + 6] << 16) | ((unsigned int)data[offset + 7] << 24);
+
+        if (memcmp(data + offset, id, 4) == 0)
+        {
+            if (length > (size - offset - 8)) return NULL;
+
+            *chunkSize = length;
+            return data + offset + 8;
+        }
+
+        offset += 8 + length + (length & 1);
+    }
+
+    return NULL;
+}
+
+// Load codec test samples: test sound or sine wave (index == sound count)
+// NOTE: Second channel differs from first one, channels interleaving is checked
+static float *LoadCodecSamples(unsigned int index, unsigned int channels, unsigned int *frameCount)
+{
+    float *mono = NULL;
+    *frameCount = RFXGEN_GEN_SAMPLE_RATE;
+
+    if (index < sizeof(testSounds)/sizeof(testSounds[0]))
+    {
+        WaveParams params = { 0 };
+        memcpy(&params, testSounds[index].params, sizeof(WaveParams));
+        mono = GenerateWave(params, frameCount);
+    }
+    else
+    {
+        // Sine wave, 440 Hz, 1 second
+        mono = (float *)RFXGEN_CALLOC(*frameCount, sizeof(float));
+        for (unsigned int f = 0; (f < *frameCount) && (mono != NULL); f++) mono[f] = 0.5f*sinf(2.0f*PI*440.0f*(float)f/RFXGEN_GEN_SAMPLE_RATE);
+    }
+
+    float *samples = (mono != NULL)? (float *)RFXGEN_CALLOC(*frameCount*channels, sizeof(float)) : NULL;
+
+    for (unsigned int f = 0; (f < *frameCount) && (samples != NULL); f++)
+    {
+        for (unsigned int c = 0; c < channels; c++) samples[f*channels + c] = (c == 0)? mono[f] : -0.5f*mono[f];
+    }
+
+    RFXGEN_FREE(mono);
+
+    return samples;
+}
+
+// Compare files data, log first difference
+static bool CompareFiles(const char *test, const char *name, const char *fileName, const char *expectedFileName)
+{
+    unsigned int size = 0;
+    unsigned int expectedSize = 0;
+    unsigned char *data = LoadTestFile(fileName, &size);
+    unsigned char *expected = LoadTestFile(expectedFileName, &expectedSize);
+    unsigned int offset = 0;
+
+    while ((offset < size) && (offset < expectedSize) && (data[offset] == expected[offset])) offset++;
+
+    bool equal = ((data != NULL) && (expected != NULL) && (size == expectedSize) && (offset == size));
+
+    if (!equal) printf("[%s] %s: FAILED, %u bytes (expected %u), first difference at byte %u\n", test, name, size, expectedSize, offset);
+    else printf("[%s] %s: OK (%u bytes)\n", test, name, size);
+
+    RFXGEN_FREE(expected);
+    RFXGEN_FREE(data);
+
+    return equal;
+}
+
+// Read big-endian 64 bit value, position is advanced
+static unsigned long long ReadQoaU64(const unsigned char *data, unsigned int *position)
+{
+    unsigned long long value = 0;
+    for (int i = 0; i < 8; i++) value = (value << 8) | data[(*position)++];
+    return value;
+}
+
+// Decode .qoa file data to 16 bit samples, NULL if not valid
+// NOTE: Minimal decoder following QOA specification, library LMS predictor and dequantization tables are reused
+static short *DecodeQoa(const unsigned char *data, unsigned int size, unsigned int *channels, unsigned int *frameCount)
+{
+    unsigned int position = 0;
+    unsigned long long value = 0;
+
+    *channels = 0;
+    *frameCount = 0;
+    if ((data == NULL) || (size < 16)) return NULL;
+
+    value = ReadQoaU64(data, &position);
+    if ((value >> 32) != QOA_MAGIC) return NULL;
+
+    unsigned int total = (unsigned int)(value & 0xffffffff);
+    unsigned int frameChannels = data[position];
+    if ((total == 0) || (frameChannels == 0) || (frameChannels > QOA_MAX_CHANNELS)) return NULL;
+
+    short *samples = (short *)RFXGEN_CALLOC(total*frameChannels, sizeof(short));
+    unsigned int decoded = 0;
+
+    while ((samples != NULL) && (decoded < total) && ((position + 8) <= size))
+    {
+        value = ReadQoaU64(data, &position);
+        unsigned int frameLength = (unsigned int)((value >> 16) & 0xffff);
+        unsigned int frameSize = (unsigned int)(value & 0xffff);
+        unsigned int slices = (frameLength + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN;
+
+        if (((unsigned int)(value >> 56) != frameChannels) || (frameLength == 0) || ((decoded + frameLength) > total) ||
+            (frameSize != QOA_FRAME_SIZE(frameChannels, slices)) || ((position - 8 + frameSize) > size)) break;
+
+        QoaLms lms[QOA_MAX_CHANNELS] = { 0 };
+
+        for (unsigned int c = 0; c < frameChannels; c++)
+        {
+            unsigned long long history = ReadQoaU64(data, &position);
+            unsigned long long weights = ReadQoaU64(data, &position);
+
+            for (int i = 0; i < QOA_LMS_LEN; i++)
+            {
+                lms[c].history[i] = (short)(history >> 48);
+                lms[c].weights[i] = (short)(weights >> 48);
+                history <<= 16;
+                weights <<= 16;
+            }
+        }
+
+        for (unsigned int sampleIndex = 0; sampleIndex < frameLength; sampleIndex += QOA_SLICE_LEN)
+        {
+            for (unsigned int c = 0; c < frameChannels; c++)
+            {
+                unsigned long long slice = ReadQoaU64(data, &position);
+                int scalefactor = (int)((slice >> 60) & 0xf);
+                unsigned int sliceEnd = ((sampleIndex + QOA_SLICE_LEN) < frameLength)? (sampleIndex + QOA_SLICE_LEN) : frameLength;
+
+                slice <<= 4;
+
+                for (unsigned int si = sampleIndex; si < sliceEnd; si++)
+                {
+                    int predicted = QoaLmsPredict(&lms[c]);
+                    int dequantized = qoaDequantTable[scalefactor][(slice >> 61) & 0x7];
+                    int reconstructed = QoaClamp(predicted + dequantized, -32768, 32767);
+
+                    samples[(decoded + si)*frameChannels + c] = (short)reconstructed;
+                    QoaLmsUpdate(&lms[c], reconstructed, dequantized);
+                    slice <<= 3;
+                }
+            }
+        }
+
+        decoded += frameLength;
+    }
+
+    if (decoded != total)
+    {
+        RFXGEN_FREE(samples);
+        return NULL;
+    }
+
+    *channels = frameChannels;
+    *frameCount = total;
+
+    return samples;
+}
+
+// Test parameters code file (.h) generator matches GenerateWave()
+// NOTE: Exported generator is a copy of library generator (rfxSynthCode), this test catches drift
+static int TestSynthCode(void)
+{
+    int failed = 0;
+
+    // Exported parameters must keep WaveParams layout
+    if (sizeof(RfxSynthParams) != sizeof(WaveParams))
+    {
+        printf("[synth] FAILED, exported parameters size %i, expected %i\n", (int)sizeof(RfxSynthParams), (int)sizeof(WaveParams));
+        return 1;
+    }
+
+    for (unsigned int i = 0; i < sizeof(testSounds)/sizeof(testSounds[0]); i++)
+    {
+        WaveParams params = { 0 };
+        memcpy(&params, testSounds[i].params, sizeof(WaveParams));
+
+        unsigned int frameCount = 0;
+        float *expected = GenerateWave(params, &frameCount);
+
+        if (!CompareFrames("synth", testSounds[i].name, expected, frameCount, testSounds[i].getData(), testSounds[i].frameCount)) failed++;
+
+        RFXGEN_FREE(expected);
+    }
+
+    return failed;
+}
+
+// Test generation function code file (.c) matches GenerateWave()
+// NOTE: Generation function is specialized for its parameters (derived values as literals,
+// disabled effects removed), every preset covers a different set of enabled effects
+static int TestFunctionCode(void)
+{
+    int failed = 0;
+
+    for (unsigned int i = 0; i < sizeof(testSounds)/sizeof(testSounds[0]); i++)
+    {
+        WaveParams params = { 0 };
+        memcpy(&params, testSounds[i].params, sizeof(WaveParams));
+
+        unsigned int frameCount = 0;
+        float *expected = GenerateWave(params, &frameCount);
+
+        float *frames = (float *)RFXGEN_CALLOC(testSounds[i].frameCount, sizeof(float));
+        unsigned int count = (frames != NULL)? testSounds[i].generate(frames) : 0;
+
+        if (!CompareFrames("function", testSounds[i].name, expected, frameCount, frames, count)) failed++;
+
+        RFXGEN_FREE(frames);
+        RFXGEN_FREE(expected);
+    }
+
+    return failed;
+}
+
+// Test interleaved generators match GenerateWave()
+// NOTE: Every generator keeps its own random state, noise waves must not depend on other
+// generators or RFXGEN_RAND() calls between generated blocks (GUI worker, live voice, prefetch)
+static int TestInterleaved(void)
+{
+    int failed = 0;
+    const unsigned int soundCount = sizeof(testSounds)/sizeof(testSounds[0]);
+
+    for (unsigned int i = 0; i < soundCount; i++)
+    {
+        WaveParams params[2] = { 0 };
+        memcpy(&params[0], testSounds[i].params, sizeof(WaveParams));
+        memcpy(&params[1], testSounds[(i + 1)%soundCount].params, sizeof(WaveParams));
+
+        unsigned int expectedCount[2] = { 0 };
+        float *expected[2] = { GenerateWave(params[0], &expectedCount[0]), GenerateWave(params[1], &expectedCount[1]) };
+
+        WaveGenerator generators[2] = { LoadWaveGenerator(params[0]), LoadWaveGenerator(params[1]) };
+        float *frames[2] = { (float *)RFXGEN_CALLOC(expectedCount[0], sizeof(float)), (float *)RFXGEN_CALLOC(expectedCount[1], sizeof(float)) };
+        unsigned int count[2] = { 0 };
+
+        if ((frames[0] != NULL) && (frames[1] != NULL))
+        {
+            // Generate small blocks alternating generators, global random state also changed between them
+            for (bool generating = true; generating; )
+            {
+                generating = false;
+
+                for (int g = 0; g < 2; g++)
+                {
+                    unsigned int blockFrames = expectedCount[g] - count[g];
+                    if (blockFrames > 256) blockFrames = 256;
+
+                    unsigned int generated = (blockFrames > 0)? GenerateWaveFrames(&generators[g], frames[g] + count[g], blockFrames) : 0;
+                    count[g] += generated;
+                    if (generated > 0) generating = true;
+
+                    (void)RFXGEN_RAND(0, 100);
+                }
+            }
+        }
+
+        if (!CompareFrames("interleaved", testSounds[i].name, expected[0], expectedCount[0], frames[0], count[0])) failed++;
+
+        for (int g = 0; g < 2; g++)
+        {
+            UnloadWaveGenerator(generators[g]);
+            RFXGEN_FREE(frames[g]);
+            RFXGEN_FREE(expected[g]);
+        }
+    }
+
+    return failed;
+}
+
+// Test quantized encoding round-trip of mutated parameters
+// NOTE: Values outside quantization ranges are clamped on encoding (accumulated mutations can
+// drift away from them), decoded values only differ from clamped values by quantization error
+static int TestEncodeMutated(void)
+{
+    int failed = 0;
+    const int quantBits[3] = { 8, 12, 16 };
+
+    for (int b = 0; b < 3; b++)
+    {
+        int bits = quantBits[b];
+        bool valid = true;
+
+        for (int i = 0; (i < 64) && valid; i++)
+        {
+            // NOTE: Mutations are accumulated, as done by Mutate button on GUI
+            RFXGEN_SRAND(2000 + i);
+            WaveParams params = GenRandomize();
+            for (int m = 0; m < 32; m++) WaveMutate(&params);
+
+            unsigned char data[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };
+            WaveParams decoded = { 0 };
+            unsigned int size = EncodeWaveParams(params, bits, data);
+
+            if ((size == 0) || (DecodeWaveParams(data, size, &decoded) != size) ||
+                (decoded.randSeed != params.randSeed) || (decoded.waveTypeValue != params.waveTypeValue))
+            {
+                printf("[encode] mutated %i bits: FAILED, sound %i not decoded\n", bits, i);
+                valid = false;
+                break;
+            }
+
+            const float *values = &params.attackTimeValue;
+            const float *decodedValues = &decoded.attackTimeValue;
+
+            for (int v = 0; v < RFXGEN_PARAMS_VALUE_COUNT; v++)
+            {
+                float range = fabsf(paramsQuantRange[v]);
+                float step = range/(float)((paramsQuantRange[v] < 0.0f)? ((1 << (bits - 1)) - 1) : ((1 << bits) - 1));
+                float expected = values[v];
+
+                if (expected > range) expected = range;
+                else if (expected < ((paramsQuantRange[v] < 0.0f)? -range : 0.0f)) expected = (paramsQuantRange[v] < 0.0f)? -range : 0.0f;
+
+                if (fabsf(decodedValues[v] - expected) > (step*0.5f + range*0.000001f))
+                {
+                    printf("[encode] mutated %i bits: FAILED, sound %i value %i: %.9g, expected %.9g\n", bits, i, v, decodedValues[v], expected);
+                    valid = false;
+                    break;
+                }
+            }
+        }
+
+        if (valid) printf("[encode] mutated %i bits: OK (64 sounds)\n", bits);
+        else failed++;
+    }
+
+    return failed;
+}
+
+// Test mutations of same parameters differ
+// NOTE: Explore window candidates are mutations of current sound generated one after another,
+// random numbers sequence must not be seeded again by every mutation
+static int TestMutateVariety(void)
+{
+    int failed = 0;
+
+    RFXGEN_SRAND(3000);
+
+    for (unsigned int i = 0; i < sizeof(testSounds)/sizeof(testSounds[0]); i++)
+    {
+        WaveParams mutations[16] = { 0 };
+        bool valid = true;
+
+        for (int m = 0; m < 16; m++)
+        {
+            memcpy(&mutations[m], testSounds[i].params, sizeof(WaveParams));
+            WaveMutate(&mutations[m]);
+
+            for (int k = 0; (k < m) && valid; k++)
+            {
+                if (memcmp(&mutations[k], &mutations[m], sizeof(WaveParams)) == 0)
+                {
+                    printf("[mutate] %s: FAILED, mutations %i and %i are equal\n", testSounds[i].name, k, m);
+                    valid = false;
+                }
+            }
+        }
+
+        if (valid) printf("[mutate] %s: OK (16 different mutations)\n", testSounds[i].name);
+        else failed++;
+    }
+
+    return failed;
+}
+
+// Test IMA-ADPCM export decoded by blocks matches 16 bit samples (mono and stereo)
+// NOTE: ADPCM is lossy, decoded samples are compared by signal-to-noise ratio, test sounds
+// hard edges (square waves, noise) are not tracked as well as a sine wave by ADPCM steps
+static int TestAdpcm(void)
+{
+    int failed = 0;
+    const unsigned int soundCount = sizeof(testSounds)/sizeof(testSounds[0]);
+
+    for (unsigned int i = 0; i <= soundCount; i++)
+    {
+        for (unsigned int channels = 1; channels <= 2; channels++)
+        {
+            const char *name = (i < soundCount)? testSounds[i].name : "sine";
+            double minSnr = (i < soundCount)? 2.0 : 30.0;
+            unsigned int frameCount = 0;
+            float *samples = LoadCodecSamples(i, channels, &frameCount);
+
+            WaveBuffer wave = { frameCount, RFXGEN_GEN_SAMPLE_RATE, 32, channels, samples };
+            unsigned int size = 0;
+            unsigned char *data = ((samples != NULL) && ExportWaveBufferADPCM(wave, "rfxgen_test_adpcm.wav"))? LoadTestFile("rfxgen_test_adpcm.wav", &size) : NULL;
+            remove("rfxgen_test_adpcm.wav");
+
+            unsigned int fmtSize = 0;
+            unsigned int dataSize = 0;
+            const unsigned char *fmt = FindWavChunk(data, size, "fmt ", &fmtSize);
+            const unsigned char *blocks = FindWavChunk(data, size, "data", &dataSize);
+
+            bool valid = ((fmt != NULL) && (blocks != NULL) && (fmtSize >= 16) && ((fmt[0] | (fmt[1] << 8)) == 0x11) && ((unsigned int)fmt[2] == channels));
+            unsigned int blockAlign = valid? (fmt[12] | (fmt[13] << 8)) : 0;
+            unsigned int blockFrames = GetAdpcmBlockFrames(blockAlign, channels);
+            short *decoded = (short *)RFXGEN_CALLOC(blockFrames*channels + 1, sizeof(short));
+            unsigned int decodedCount = 0;
+            double signal = 0.0;
+            double noise = 0.0;
+
+            for (unsigned int offset = 0; valid && (decoded != NULL) && (blockFrames > 0) && ((offset + blockAlign) <= dataSize) && (decodedCount < frameCount); offset += blockAlign)
+            {
+                DecodeAdpcmBlock(blocks + offset, blockAlign, channels, decoded);
+
+                for (unsigned int f = 0; (f < blockFrames) && (decodedCount < frameCount); f++, decodedCount++)
+                {
+                    for (unsigned int c = 0; c < channels; c++)
+                    {
+                        double expected = (double)(short)(samples[decodedCount*channels + c]*32767.0f);
+                        double difference = (double)decoded[f*channels + c] - expected;
+
+                        signal += expected*expected;
+                        noise += difference*difference;
+                    }
+                }
+            }
+
+            double snr = (noise > 0.0)? 10.0*log10(signal/noise) : 999.0;
+
+            if ((samples == NULL) || (decodedCount != frameCount) || (snr < minSnr))
+            {
+                printf("[adpcm] %s %u channel(s): FAILED, %u frames decoded (expected %u), SNR %.1f dB\n", name, channels, decodedCount, frameCount, snr);
+                failed++;
+            }
+            else printf("[adpcm] %s %u channel(s): OK (%u frames, SNR %.1f dB)\n", name, channels, frameCount, snr);
+
+            RFXGEN_FREE(decoded);
+            RFXGEN_FREE(data);
+            RFXGEN_FREE(samples);
+        }
+    }
+
+    return failed;
+}
+
+// Test IMA-ADPCM invalid block sizes are rejected, nothing decoded
+// NOTE: Channels data is interleaved in groups of 4 bytes per channel after blocks header,
+// other sizes would read past block and write past frames
+static int TestAdpcmMalformed(void)
+{
+    int failed = 0;
+    const unsigned int blockTests[][3] = {
+        // blockAlign, channels, expected frames
+        { 5, 1, 0 }, { 4, 1, 0 }, { 6, 0, 0 }, { 12, 2, 0 }, { 20, 2, 0 },
+        { 8, 1, 9 }, { 36, 1, 65 }, { 24, 2, 17 }, { 1024, 1, 2041 }, { 2048, 2, 2041 },
+    };
+
+    for (unsigned int i = 0; i < sizeof(blockTests)/sizeof(blockTests[0]); i++)
+    {
+        unsigned int frames = GetAdpcmBlockFrames(blockTests[i][0], blockTests[i][1]);
+
+        if (frames != blockTests[i][2])
+        {
+            printf("[adpcm] block size %u, %u channel(s): FAILED, %u frames, expected %u\n", blockTests[i][0], blockTests[i][1], frames, blockTests[i][2]);
+            failed++;
+        }
+    }
+
+    // Invalid block size: block and frames are not accessed past their size
+    unsigned char block[5] = { 0x10, 0x20, 0x10, 0x00, 0x77 };
+    short frames[3] = { 0x1234, 0x1234, 0x1234 };
+
+    DecodeAdpcmBlock(block, sizeof(block), 1, frames);
+
+    if ((frames[0] != 0x1234) || (frames[1] != 0x1234) || (frames[2] != 0x1234))
+    {
+        printf("[adpcm] malformed block: FAILED, invalid block decoded\n");
+        failed++;
+    }
+
+    if (failed == 0) printf("[adpcm] malformed blocks: OK\n");
+
+    return failed;
+}
+
+// Test QOA export decoded matches 16 bit samples (mono and stereo)
+// NOTE: QOA is lossy, decoded samples are compared by signal-to-noise ratio,
+// sound is longer than a QOA frame, frames LMS state and last short slice are checked
+static int TestQoa(void)
+{
+    int failed = 0;
+    const unsigned int soundCount = sizeof(testSounds)/sizeof(testSounds[0]);
+
+    for (unsigned int i = 0; i <= soundCount; i++)
+    {
+        for (unsigned int channels = 1; channels <= 2; channels++)
+        {
+            const char *name = (i < soundCount)? testSounds[i].name : "sine";
+            double minSnr = (i < soundCount)? 10.0 : 40.0;
+            unsigned int frameCount = 0;
+            float *samples = LoadCodecSamples(i, channels, &frameCount);
+
+            WaveBuffer wave = { frameCount, RFXGEN_GEN_SAMPLE_RATE, 32, channels, samples };
+            unsigned int size = 0;
+            unsigned char *data = ((samples != NULL) && ExportWaveBuffer(wave, "rfxgen_test_qoa.qoa"))? LoadTestFile("rfxgen_test_qoa.qoa", &size) : NULL;
+            remove("rfxgen_test_qoa.qoa");
+
+            unsigned int decodedChannels = 0;
+            unsigned int decodedCount = 0;
+            short *decoded = DecodeQoa(data, size, &decodedChannels, &decodedCount);
+            double signal = 0.0;
+            double noise = 0.0;
+
+            for (unsigned int f = 0; (decoded != NULL) && (decodedChannels == channels) && (f < decodedCount) && (f < frameCount); f++)
+            {
+                for (unsigned int c = 0; c < channels; c++)
+                {
+                    double expected = (double)(short)(samples[f*channels + c]*32767.0f);
+                    double difference = (double)decoded[f*channels + c] - expected;
+
+                    signal += expected*expected;
+                    noise += difference*difference;
+                }
+            }
+
+            double snr = (noise > 0.0)? 10.0*log10(signal/noise) : 999.0;
+
+            if ((decoded == NULL) || (decodedChannels != channels) || (decodedCount != frameCount) || (snr < minSnr))
+            {
+                printf("[qoa] %s %u channel(s): FAILED, %u frames decoded (expected %u), SNR %.1f dB\n", name, channels, decodedCount, frameCount, snr);
+                failed++;
+            }
+            else printf("[qoa] %s %u channel(s): OK (%u frames, SNR %.1f dB)\n", name, channels, frameCount, snr);
+
+            RFXGEN_FREE(decoded);
+            RFXGEN_FREE(data);
+            RFXGEN_FREE(samples);
+        }
+    }
+
+    return failed;
+}
+
+// Test streaming writer files match wave buffer export files (mono and stereo)
+// NOTE: Frames are written in blocks not multiple of codecs blocks, writer buffering is checked
+static int TestWaveWriter(void)
+{
+    int failed = 0;
+    const struct { const char *extension; int sampleSize; } formats[] = {
+        { ".wav", 8 }, { ".wav", 16 }, { ".wav", 32 }, { ".raw", 8 }, { ".raw", 16 }, { ".raw", 32 }, { ".qoa", 16 }, { ".wav", 4 }
+    };
+
+    for (unsigned int i = 0; i < sizeof(formats)/sizeof(formats[0]); i++)
+    {
+        for (unsigned int channels = 1; channels <= 2; channels++)
+        {
+            char name[64] = { 0 };
+            char writerFileName[64] = { 0 };
+            char exportFileName[64] = { 0 };
+            snprintf(name, 64, "%s %i bit %u channel(s)", formats[i].extension, formats[i].sampleSize, channels);
+            snprintf(writerFileName, 64, "rfxgen_test_writer%s", formats[i].extension);
+            snprintf(exportFileName, 64, "rfxgen_test_export%s", formats[i].extension);
+
+            unsigned int frameCount = 0;
+            float *samples = LoadCodecSamples(sizeof(testSounds)/sizeof(testSounds[0]), channels, &frameCount);  // Sine wave, several QOA frames
+            WaveWriter writer = OpenWaveWriter(writerFileName, RFXGEN_GEN_SAMPLE_RATE, formats[i].sampleSize, channels);
+            bool written = IsWaveWriterValid(writer) && (samples != NULL);
+            bool exported = false;
+
+            for (unsigned int offset = 0; written && (offset < frameCount); offset += 1000)
+            {
+                unsigned int count = ((frameCount - offset) < 1000)? (frameCount - offset) : 1000;
+                written = WriteWaveFrames(&writer, samples + offset*channels, count);
+            }
+
+            if (IsWaveWriterValid(writer)) written = CloseWaveWriter(&writer) && written;
+
+            WaveBuffer wave = { frameCount, RFXGEN_GEN_SAMPLE_RATE, 32, channels, samples };
+
+            if (samples == NULL) exported = false;
+            else if (formats[i].sampleSize == 4) exported = ExportWaveBufferADPCM(wave, exportFileName);
+            else
+            {
+                WaveBuffer converted = WaveBufferCopy(wave);
+                WaveBufferFormat(&converted, RFXGEN_GEN_SAMPLE_RATE, formats[i].sampleSize, channels);
+                exported = ExportWaveBuffer(converted, exportFileName);
+                UnloadWaveBuffer(converted);
+            }
+
+            if (!written || !exported)
+            {
+                printf("[writer] %s: FAILED, file could not be written (writer: %i, export: %i)\n", name, written, exported);
+                failed++;
+            }
+            else if (!CompareFiles("writer", name, writerFileName, exportFileName)) failed++;
+
+            remove(writerFileName);
+            remove(exportFileName);
+            RFXGEN_FREE(samples);
+        }
+    }
+
+    return failed;
+}
+
+// Test embedding data file (.bin) matches raw samples, header describes it (mono and stereo)
+static int TestEmbed(void)
+{
+    int failed = 0;
+
+    for (unsigned int channels = 1; channels <= 2; channels++)
+    {
+        char name[64] = { 0 };
+        snprintf(name, 64, "%u channel(s)", channels);
+
+        unsigned int frameCount = 0;
+        float *samples = LoadCodecSamples(0, channels, &frameCount);
+        WaveBuffer wave = { frameCount, RFXGEN_GEN_SAMPLE_RATE, 32, channels, samples };
+        WaveBuffer converted = WaveBufferCopy(wave);
+        WaveBufferFormat(&converted, RFXGEN_GEN_SAMPLE_RATE, 16, channels);
+
+        if ((samples == NULL) || !ExportWaveBuffer(converted, "rfxgen_test_embed.bin") || !ExportWaveBuffer(converted, "rfxgen_test_embed.raw"))
+        {
+            printf("[embed] %s: FAILED, file could not be exported\n", name);
+            failed++;
+        }
+        else if (!CompareFiles("embed", name, "rfxgen_test_embed.bin", "rfxgen_test_embed.raw")) failed++;
+
+        // Header defines data format and size, data file is referenced by name (relative to header)
+        unsigned int size = 0;
+        unsigned char *header = LoadTestFile("rfxgen_test_embed.h", &size);
+        char *text = (char *)RFXGEN_CALLOC(size + 1, 1);    // NULL terminated header text
+        if ((header != NULL) && (text != NULL)) memcpy(text, header, size);
+
+        const struct { const char *define; unsigned int value; } defines[] = {
+            { "RFXGEN_TEST_EMBED_FRAME_COUNT", frameCount },
+            { "RFXGEN_TEST_EMBED_SAMPLE_RATE", RFXGEN_GEN_SAMPLE_RATE },
+            { "RFXGEN_TEST_EMBED_SAMPLE_SIZE", 16 },
+            { "RFXGEN_TEST_EMBED_CHANNELS", channels },
+            { "RFXGEN_TEST_EMBED_DATA_SIZE", frameCount*channels*2 },
+        };
+
+        for (unsigned int d = 0; d < sizeof(defines)/sizeof(defines[0]); d++)
+        {
+            const char *define = (text != NULL)? strstr(text, defines[d].define) : NULL;
+            unsigned int value = 0;
+
+            if ((define == NULL) || (sscanf(define + strlen(defines[d].define), " %u", &value) != 1) || (value != defines[d].value))
+            {
+                printf("[embed] %s: FAILED, header %s: %u, expected %u\n", name, defines[d].define, value, defines[d].value);
+                failed++;
+            }
+        }
+
+        if ((text == NULL) || (strstr(text, "_DATA_FILE        \"rfxgen_test_embed.bin\"") == NULL))
+        {
+            printf("[embed] %s: FAILED, header data file not referenced\n", name);
+            failed++;
+        }
+
+        remove("rfxgen_test_embed.bin");
+        remove("rfxgen_test_embed.raw");
+        remove("rfxgen_test_embed.h");
+        RFXGEN_FREE(text);
+        RFXGEN_FREE(header);
+        UnloadWaveBuffer(converted);
+        RFXGEN_FREE(samples);
+    }
+
+    return failed;
+}
+
+// Test parameters bank save/load and lookup by name (plain and encoded banks)
+static int TestWaveBank(void)
+{
+    int failed = 0;
+    const unsigned int soundCount = sizeof(testSounds)/sizeof(testSounds[0]);
+    WaveParams params[sizeof(testSounds)/sizeof(testSounds[0])] = { 0 };
+    const char *names[sizeof(testSounds)/sizeof(testSounds[0])] = { 0 };
+
+    for (unsigned int i = 0; i < soundCount; i++)
+    {
+        memcpy(&params[i], testSounds[i].params, sizeof(WaveParams));
+        names[i] = testSounds[i].name;
+    }
+
+    for (int encoded = 0; encoded <= 1; encoded++)
+    {
+        const char *name = encoded? "encoded bank" : "bank";
+        bool saved = encoded? SaveWaveBankEncoded(params, names, soundCount, 16, "rfxgen_test_bank.rfxb") : SaveWaveBank(params, names, soundCount, "rfxgen_test_bank.rfxb");
+        WaveBank bank = saved? LoadWaveBank("rfxgen_test_bank.rfxb") : (WaveBank){ 0 };
+        int errors = 0;
+
+        if (!IsWaveBankValid(bank) || (bank.soundCount != soundCount))
+        {
+            printf("[bank] %s: FAILED, bank could not be saved or loaded\n", name);
+            errors++;
+        }
+
+        for (unsigned int i = 0; (errors == 0) && (i < soundCount); i++)
+        {
+            // Encoded banks return quantized parameters, compared with parameters encoding round-trip
+            WaveParams expected = params[i];
+
+            if (encoded)
+            {
+                unsigned char data[RFXGEN_PARAMS_ENCODED_MAX_SIZE] = { 0 };
+                unsigned int size = EncodeWaveParams(params[i], 16, data);
+                DecodeWaveParams(data, size, &expected);
+            }
+
+            int id = GetWaveBankSoundId(bank, names[i]);
+            WaveParams loaded = GetWaveBankSoundParams(bank, id);
+            const WaveParams *mapped = GetWaveBankSound(bank, names[i]);
+            const char *soundName = GetWaveBankSoundName(bank, id);
+
+            if ((id != (int)i) || (soundName == NULL) || (strcmp(soundName, names[i]) != 0) ||
+                (memcmp(&loaded, &expected, sizeof(WaveParams)) != 0) ||
+                (encoded && (mapped != NULL)) || (!encoded && ((mapped == NULL) || (memcmp(mapped, &expected, sizeof(WaveParams)) != 0))))
+            {
+                printf("[bank] %s: FAILED, sound %s (id %i) does not match\n", name, names[i], id);
+                errors++;
+            }
+        }
+
+        if ((errors == 0) && ((GetWaveBankSoundId(bank, "missing") != -1) || (GetWaveBankSound(bank, "missing") != NULL)))
+        {
+            printf("[bank] %s: FAILED, missing sound found\n", name);
+            errors++;
+        }
+
+        if (errors == 0) printf("[bank] %s: OK (%u sounds)\n", name, soundCount);
+
+        UnloadWaveBank(bank);
+        remove("rfxgen_test_bank.rfxb");
+        failed += errors;
+    }
+
+    return failed;
+}
+
+// Test data bank save/load, sounds data matches rendered frames
+// NOTE: Sounds are stored in different formats, samples data points into bank file data
+static int TestWavePcmBank(void)
+{
+    int failed = 0;
+    const unsigned int soundCount = sizeof(testSounds)/sizeof(testSounds[0]);
+    WaveBuffer waves[sizeof(testSounds)/sizeof(testSounds[0])] = { 0 };
+    const char *names[sizeof(testSounds)/sizeof(testSounds[0])] = { 0 };
+    const int sampleSizes[3] = { 8, 16, 32 };
+
+    for (unsigned int i = 0; i < soundCount; i++)
+    {
+        unsigned int channels = 1 + i%2;
+        WaveBuffer wave = { 0, RFXGEN_GEN_SAMPLE_RATE, 32, channels, NULL };
+        wave.data = LoadCodecSamples(i, channels, &wave.frameCount);
+
+        waves[i] = WaveBufferCopy(wave);
+        WaveBufferFormat(&waves[i], RFXGEN_GEN_SAMPLE_RATE, sampleSizes[i%3], channels);
+        names[i] = testSounds[i].name;
+
+        UnloadWaveBuffer(wave);
+    }
+
+    WavePcmBank bank = SaveWavePcmBank(waves, names, soundCount, "rfxgen_test_bank.rfxp")? LoadWavePcmBank("rfxgen_test_bank.rfxp") : (WavePcmBank){ 0 };
+
+    if (!IsWavePcmBankValid(bank) || (bank.soundCount != soundCount))
+    {
+        printf("[pcm bank] FAILED, bank could not be saved or loaded\n");
+        failed++;
+    }
+
+    for (unsigned int i = 0; (failed == 0) && (i < soundCount); i++)
+    {
+        int id = GetWavePcmBankSoundId(bank, names[i]);
+        WaveBuffer wave = GetWavePcmBankSound(bank, id);
+        unsigned int dataSize = waves[i].frameCount*waves[i].channels*waves[i].sampleSize/8;
+
+        if ((id != (int)i) || (wave.data == NULL) || (wave.frameCount != waves[i].frameCount) || (wave.sampleRate != waves[i].sampleRate) ||
+            (wave.sampleSize != waves[i].sampleSize) || (wave.channels != waves[i].channels) || (memcmp(wave.data, waves[i].data, dataSize) != 0))
+        {
+            printf("[pcm bank] %s: FAILED, sound (id %i, %u frames, %u bit, %u channel(s)) does not match\n", names[i], id, wave.frameCount, wave.sampleSize, wave.channels);
+            failed++;
+        }
+        else printf("[pcm bank] %s: OK (%u frames, %u bit, %u channel(s))\n", names[i], wave.frameCount, wave.sampleSize, wave.channels);
+    }
+
+    UnloadWavePcmBank(bank);
+    remove("rfxgen_test_bank.rfxp");
+    for (unsigned int i = 0; i < soundCount; i++) UnloadWaveBuffer(waves[i]);
+
+    return failed;
+}
+
+// Test parameters list loading with missing and corrupt files, per file errors are reported
+// NOTE: Directory loading is checked with test directory (current), other .rfx files are ignored
+static int TestParamsList(void)
+{
+    int failed = 0;
+    WaveParams params = { 0 };
+    memcpy(&params, testSounds[0].params, sizeof(WaveParams));
+
+    // Test files: valid, missing, not an rFX file, truncated
+    SaveWaveParams(params, "rfxgen_test_list_0.rfx");
+
+    FILE *file = fopen("rfxgen_test_list_2.rfx", "wb");
+    if (file != NULL) { fwrite("not an rfx file, corrupt data", 1, 29, file); fclose(file); }
+
+    unsigned int size = 0;
+    unsigned char *data = LoadTestFile("rfxgen_test_list_0.rfx", &size);
+    file = fopen("rfxgen_test_list_3.rfx", "wb");
+    if (file != NULL) { if (data != NULL) fwrite(data, 1, size/2, file); fclose(file); }
+    RFXGEN_FREE(data);
+
+    const char *fileNames[4] = { "rfxgen_test_list_0.rfx", "rfxgen_test_list_1.rfx", "rfxgen_test_list_2.rfx", "rfxgen_test_list_3.rfx" };
+    const unsigned char errors[4] = { RFXGEN_LOAD_SUCCESS, RFXGEN_LOAD_ERROR_OPEN, RFXGEN_LOAD_ERROR_FORMAT, RFXGEN_LOAD_ERROR_READ };
+    const WaveParams zero = { 0 };
+
+    for (int directory = 0; directory <= 1; directory++)
+    {
+        const char *name = directory? "directory" : "files";
+        WaveParamsList list = directory? LoadWaveParamsDirectory(".") : LoadWaveParamsList(fileNames, 4);
+        int errorCount = 0;
+
+        // Test files are looked up by name, directory list only contains existing files
+        for (int i = 0; i < 4; i++)
+        {
+            if (directory && (errors[i] == RFXGEN_LOAD_ERROR_OPEN)) continue;
+
+            unsigned int index = 0;
+            while ((index < list.count) && (strstr(list.fileNames[index], fileNames[i]) == NULL)) index++;
+
+            if (index == list.count)
+            {
+                printf("[list] %s: FAILED, %s not listed\n", name, fileNames[i]);
+                errorCount++;
+            }
+            else if ((list.errors[index] != errors[i]) ||
+                     (memcmp(&list.params[index], (errors[i] == RFXGEN_LOAD_SUCCESS)? &params : &zero, sizeof(WaveParams)) != 0))
+            {
+                printf("[list] %s: FAILED, %s error %i, expected %i\n", name, fileNames[i], list.errors[index], errors[i]);
+                errorCount++;
+            }
+        }
+
+        if ((errorCount == 0) && (list.errorCount < (directory? 2u : 3u)))
+        {
+            printf("[list] %s: FAILED, %u errors counted\n", name, list.errorCount);
+            errorCount++;
+        }
+
+        if (errorCount == 0) printf("[list] %s: OK (%u files, %u errors)\n", name, list.count, list.errorCount);
+
+        UnloadWaveParamsList(list);
+        failed += errorCount;
+    }
+
+    // Directory not found: empty list with one error
+    WaveParamsList list = LoadWaveParamsDirectory("rfxgen_test_missing_directory");
+
+    if ((list.count != 0) || (list.errorCount != 1))
+    {
+        printf("[list] missing directory: FAILED, %u files, %u errors\n", list.count, list.errorCount);
+        failed++;
+    }
+    else printf("[list] missing directory: OK\n");
+
+    UnloadWaveParamsList(list);
+    for (int i = 0; i < 4; i++) remove(fileNames[i]);
+
+    return failed;
+}
+#endif